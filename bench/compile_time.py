@@ -0,0 +1,243 @@
+"""
+Measure the compile time and memory of translation units instantiating N distinct maybe, result
+and either types, each with a chain of monadic calls.
+
+A count of 0 measures the cost of including the headers alone. Every configuration is compiled
+`--repeat` times and the fastest run is kept. With Clang, `-ftime-trace` is used to split the
+time spent in the front end and in template instantiation; with GCC, `-ftime-report` is used.
+
+With `--module`, the same translation units are also compiled with `import reglisse;` in place of
+the includes, once the module interface is built. The clean build time of a consumer made of
+`--units` such translation units is then reported with and without the module: the module is
+built once, the headers are parsed by every unit.
+
+Usage: compile_time.py [--compiler g++] [--include .] [--counts 0 50 200] [--module]
+                       [--units 20] [--output out.json]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+INCLUDES = '''#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+'''
+
+IMPORT = '''#include <utility>
+
+import reglisse;
+'''
+
+PRELUDE = '''
+using namespace reglisse;
+
+template <int I>
+struct value
+{
+   int v;
+};
+
+template <int I>
+struct error
+{
+   int code;
+};
+'''
+
+INSTANCE = '''
+auto chain_{i}(int input) -> int
+{{
+   using value_type = value<{i}>;
+   using error_type = error<{i}>;
+
+   auto res = input > 0 ? result<value_type, error_type>(ok(value_type{{input}}))
+                        : result<value_type, error_type>(err(error_type{{input}}));
+
+   auto total = std::move(res)
+                   .transform([](value_type v) {{ return value_type{{v.v * 2}}; }})
+                   .and_then([](value_type v) -> result<value_type, error_type> {{
+                      return ok(value_type{{v.v + 1}});
+                   }})
+                   .or_else([](error_type e) -> result<value_type, error_type> {{
+                      return err(error_type{{e.code - 1}});
+                   }})
+                   .transform_err([](error_type e) {{ return e; }})
+                   .take_or(value_type{{0}})
+                   .v;
+
+   auto opt = input % 2 == 0 ? maybe<value_type>(some(value_type{{input}})) : maybe<value_type>();
+   total += std::move(opt)
+               .transform([](value_type v) {{ return value_type{{v.v - 1}}; }})
+               .and_then([](value_type v) -> maybe<value_type> {{ return some(std::move(v)); }})
+               .take_or(value_type{{0}})
+               .v;
+
+   auto eit = input % 3 == 0 ? either<value_type, error_type>(left(value_type{{input}}))
+                             : either<value_type, error_type>(right(error_type{{input}}));
+   total += std::move(eit)
+               .transform_left([](value_type v) {{ return v.v; }})
+               .transform_right([](error_type e) {{ return e.code; }})
+               .join();
+
+   return total;
+}}
+'''
+
+
+def generate(count, use_module):
+    return ((IMPORT if use_module else INCLUDES) + PRELUDE +
+            ''.join(INSTANCE.format(i=i) for i in range(count)))
+
+
+def is_clang(compiler):
+    return 'clang' in os.path.basename(compiler)
+
+
+def module_flags(compiler, work_dir):
+    """
+    The flags importing the module interface built by `build_module` in `work_dir`. GCC finds it
+    in the `gcm.cache` directory of the working directory.
+    """
+    if is_clang(compiler):
+        return [f'-fmodule-file=reglisse={os.path.join(work_dir, "reglisse.pcm")}']
+    return ['-fmodules-ts']
+
+
+def build_module(compiler, include, flags, work_dir):
+    """
+    Build the interface of the reglisse module in `work_dir` and return its wall time and peak
+    memory.
+    """
+    interface = os.path.join(include, 'libreglisse', 'reglisse.cppm')
+    if is_clang(compiler):
+        command = [compiler, '-std=c++20', f'-I{include}', '--precompile', '-x', 'c++-module',
+                   interface, '-o', os.path.join(work_dir, 'reglisse.pcm'), *flags]
+    else:
+        command = [compiler, '-std=c++20', f'-I{include}', '-fmodules-ts', '-x', 'c++', '-c',
+                   interface, '-o', os.path.join(work_dir, 'reglisse.o'), *flags]
+
+    elapsed, peak, _ = run(command, work_dir)
+    return elapsed, peak
+
+
+def run(command, work_dir):
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stderr=subprocess.PIPE, text=True, cwd=work_dir)
+    stderr = process.stderr.read()
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+
+    if os.waitstatus_to_exitcode(status) != 0:
+        sys.exit(f'error: compilation failed\n{stderr}')
+
+    return elapsed, usage.ru_maxrss, stderr
+
+
+def compile_once(compiler, include, source, flags, trace_dir):
+    """
+    Compile `source` and return its wall time in seconds, peak memory in KiB, and the
+    compiler's own timings when available.
+    """
+    timing_flag = ['-ftime-trace'] if is_clang(compiler) else ['-ftime-report']
+
+    command = [compiler, '-std=c++20', f'-I{include}', '-c', source, '-o',
+               os.path.join(trace_dir, 'out.o'), *timing_flag, *flags]
+
+    elapsed, peak, stderr = run(command, trace_dir)
+    phases = parse_clang_trace(trace_dir) if is_clang(compiler) else parse_gcc_report(stderr)
+
+    return elapsed, peak, phases
+
+
+def parse_gcc_report(report):
+    phases = {}
+    for line in report.splitlines():
+        match = re.match(r'\s*phase ([^:]+?)\s*:', line)
+        times = re.findall(r'([\d.]+) \(\s*\d+%\)', line)
+        if match and len(times) >= 3:
+            phases[match.group(1).strip()] = float(times[2])
+    return phases
+
+
+def parse_clang_trace(trace_dir):
+    phases = {}
+    with open(os.path.join(trace_dir, 'out.json'), encoding='utf-8') as trace:
+        for event in json.load(trace).get('traceEvents', []):
+            if event.get('name', '').startswith('Total '):
+                phases[event['name'][len('Total '):]] = event.get('dur', 0) / 1e6
+    return phases
+
+
+def measure(args, count, use_module, work_dir):
+    source = os.path.join(work_dir, f'instances_{count}.cpp')
+    with open(source, 'w', encoding='utf-8') as file:
+        file.write(generate(count, use_module))
+
+    flags = [*module_flags(args.compiler, work_dir), *args.flags] if use_module else args.flags
+    runs = [compile_once(args.compiler, os.path.abspath(args.include), source, flags, work_dir)
+            for _ in range(args.repeat)]
+
+    elapsed, peak, phases = min(runs, key=lambda run: run[0])
+
+    front_end = ', '.join(f'{name} {seconds:.2f}s' for name, seconds in phases.items()
+                          if re.search(r'pars|lang|Frontend|Instantiate', name))
+    mode = 'import' if use_module else 'include'
+    print(f'{count:5} instances, {mode:7}: {elapsed:6.2f}s {peak:8} KiB  {front_end}')
+
+    return {'instances': count, 'seconds': round(elapsed, 3), 'peak_kib': peak, 'phases': phases}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'g++'))
+    parser.add_argument('--include', default=os.path.join(os.path.dirname(__file__), '..'))
+    parser.add_argument('--counts', type=int, nargs='+', default=[0, 50, 200])
+    parser.add_argument('--repeat', type=int, default=3)
+    parser.add_argument('--flags', nargs=argparse.REMAINDER, default=['-O0'])
+    parser.add_argument('--module', action='store_true',
+                        help='also measure the translation units importing the reglisse module')
+    parser.add_argument('--units', type=int, default=20,
+                        help='the number of translation units of the consumer built with --module')
+    parser.add_argument('--output', help='write the results as JSON to this file')
+    args = parser.parse_args()
+
+    output = {'compiler': args.compiler, 'flags': args.flags, 'results': []}
+
+    with tempfile.TemporaryDirectory() as work_dir:
+        if args.module:
+            module_seconds, module_peak = build_module(args.compiler, os.path.abspath(args.include),
+                                                       args.flags, work_dir)
+            output['module'] = {'seconds': round(module_seconds, 3), 'peak_kib': module_peak}
+            print(f'module interface: {module_seconds:6.2f}s {module_peak:8} KiB')
+
+        for count in args.counts:
+            result = measure(args, count, False, work_dir)
+
+            if args.module:
+                result['import'] = measure(args, count, True, work_dir)
+
+                with_includes = args.units * result['seconds']
+                with_module = module_seconds + args.units * result['import']['seconds']
+                result['clean_build'] = {'units': args.units, 'includes': round(with_includes, 3),
+                                         'module': round(with_module, 3)}
+                print(f'      clean build of {args.units} units: {with_includes:6.2f}s with '
+                      f'includes, {with_module:6.2f}s with the module')
+
+            output['results'].append(result)
+
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as file:
+            json.dump(output, file, indent=2)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,366 @@
+#include "inputs.hpp"
+
+#include <libreglisse/either.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   struct parse_error
+   {
+      std::uint32_t input;
+   };
+
+   using step_either = either<std::uint32_t, parse_error>;
+   using step_variant = std::variant<std::uint32_t, parse_error>;
+
+   LIBREGLISSE_BENCH_NOINLINE auto either_step(std::uint32_t value) -> step_either
+   {
+      if (value == bench::invalid_input)
+      {
+         return right(parse_error{value});
+      }
+
+      return left(value * 3U + 1U);
+   }
+
+   LIBREGLISSE_BENCH_NOINLINE auto variant_step(std::uint32_t value) -> step_variant
+   {
+      if (value == bench::invalid_input)
+      {
+         return parse_error{value};
+      }
+
+      return value * 3U + 1U;
+   }
+
+   template <class T>
+   auto make_eithers() -> std::vector<either<T, std::string>>
+   {
+      std::vector<either<T, std::string>> eithers;
+      for (auto& value : bench::make_values<T>())
+      {
+         eithers.push_back(make_left<T, std::string>(std::move(value)));
+      }
+
+      return eithers;
+   }
+
+   template <class T>
+   auto make_variants() -> std::vector<std::variant<T, std::string>>
+   {
+      std::vector<std::variant<T, std::string>> variants;
+      for (auto& value : bench::make_values<T>())
+      {
+         variants.emplace_back(std::in_place_index<0>, std::move(value));
+      }
+
+      return variants;
+   }
+
+   template <class T>
+   void either_construct(benchmark::State& state)
+   {
+      const auto values = bench::make_values<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            auto constructed = either<T, std::string>(in_place_left, value);
+            benchmark::DoNotOptimize(constructed);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void variant_construct(benchmark::State& state)
+   {
+      const auto values = bench::make_values<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            auto constructed = std::variant<T, std::string>(std::in_place_index<0>, value);
+            benchmark::DoNotOptimize(constructed);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void either_copy(benchmark::State& state)
+   {
+      const auto eithers = make_eithers<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : eithers)
+         {
+            either<T, std::string> copy = value;
+            benchmark::DoNotOptimize(copy);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void variant_copy(benchmark::State& state)
+   {
+      const auto variants = make_variants<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : variants)
+         {
+            std::variant<T, std::string> copy = value;
+            benchmark::DoNotOptimize(copy);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   /**
+    * @brief Move every value out and back in, two moves per item.
+    */
+   template <class T>
+   void either_move(benchmark::State& state)
+   {
+      auto eithers = make_eithers<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (auto& value : eithers)
+         {
+            either<T, std::string> moved = std::move(value);
+            benchmark::DoNotOptimize(moved);
+            value = std::move(moved);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void variant_move(benchmark::State& state)
+   {
+      auto variants = make_variants<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (auto& value : variants)
+         {
+            std::variant<T, std::string> moved = std::move(value);
+            benchmark::DoNotOptimize(moved);
+            value = std::move(moved);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+} // namespace
+
+BENCHMARK_TEMPLATE(either_construct, std::uint64_t);
+BENCHMARK_TEMPLATE(variant_construct, std::uint64_t);
+BENCHMARK_TEMPLATE(either_construct, std::string);
+BENCHMARK_TEMPLATE(variant_construct, std::string);
+
+BENCHMARK_TEMPLATE(either_copy, std::uint64_t);
+BENCHMARK_TEMPLATE(variant_copy, std::uint64_t);
+BENCHMARK_TEMPLATE(either_copy, std::string);
+BENCHMARK_TEMPLATE(variant_copy, std::string);
+
+BENCHMARK_TEMPLATE(either_move, std::uint64_t);
+BENCHMARK_TEMPLATE(variant_move, std::uint64_t);
+BENCHMARK_TEMPLATE(either_move, std::string);
+BENCHMARK_TEMPLATE(variant_move, std::string);
+
+static void either_transform_chain(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = input == bench::invalid_input ? step_either(right(parse_error{input}))
+                                                    : step_either(left(std::uint32_t{input}));
+
+         sum += std::move(value)
+                   .transform_left([](std::uint32_t v) {
+                      return v * 3U;
+                   })
+                   .transform_left([](std::uint32_t v) {
+                      return std::uint64_t{v} + 7U;
+                   })
+                   .transform_left([](std::uint64_t v) {
+                      return v ^ 0x5bd1e995U; // NOLINT
+                   })
+                   .transform_left([](std::uint64_t v) {
+                      return v >> 1U;
+                   })
+                   .match(
+                      [](std::uint64_t v) {
+                         return v;
+                      },
+                      [](parse_error) {
+                         return std::uint64_t{0};
+                      });
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(either_transform_chain)->Apply(bench::failure_rates);
+
+static void variant_transform_chain(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = input == bench::invalid_input ? step_variant(parse_error{input})
+                                                    : step_variant(std::uint32_t{input});
+
+         if (const auto* v = std::get_if<0>(&value))
+         {
+            std::uint64_t transformed = std::uint64_t{*v * 3U} + 7U;
+            transformed ^= 0x5bd1e995U; // NOLINT
+            sum += transformed >> 1U;
+         }
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(variant_transform_chain)->Apply(bench::failure_rates);
+
+static void either_flat_transform_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = step_either(left(std::uint32_t{input}));
+         for (std::int64_t i = 0; i < depth; ++i)
+         {
+            value = std::move(value).flat_transform_left(either_step);
+         }
+
+         sum += value.is_left() ? value.borrow_left() : 0U;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(either_flat_transform_depth)->Apply(bench::depths);
+
+static void variant_flat_transform_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = step_variant(input);
+         for (std::int64_t i = 0; i < depth and value.index() == 0; ++i)
+         {
+            value = variant_step(std::get<0>(value));
+         }
+
+         sum += value.index() == 0 ? std::get<0>(value) : 0U;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(variant_flat_transform_depth)->Apply(bench::depths);
+
+static void either_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = either_step(input)
+                         .flat_transform_left(either_step)
+                         .flat_transform_left(either_step)
+                         .flat_transform_left(either_step);
+
+         sum += value.is_left() ? value.borrow_left() : 0U;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(either_propagation)->Apply(bench::failure_rates);
+
+static void variant_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = variant_step(input);
+         if (value.index() == 0)
+         {
+            value = variant_step(std::get<0>(value));
+         }
+         if (value.index() == 0)
+         {
+            value = variant_step(std::get<0>(value));
+         }
+         if (value.index() == 0)
+         {
+            value = variant_step(std::get<0>(value));
+         }
+
+         sum += value.index() == 0 ? std::get<0>(value) : 0U;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(variant_propagation)->Apply(bench::failure_rates);
@@ -0,0 +1,96 @@
+#ifndef LIBREGLISSE_BENCH_INPUTS_HPP
+#define LIBREGLISSE_BENCH_INPUTS_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__)
+#   define LIBREGLISSE_BENCH_NOINLINE [[gnu::noinline]]
+#else
+#   define LIBREGLISSE_BENCH_NOINLINE
+#endif // defined(__GNUC__)
+
+namespace bench
+{
+   constexpr std::size_t input_count = 1 << 16;
+
+   constexpr std::uint32_t invalid_input = 0;
+
+   /**
+    * @brief Build shuffled inputs where `failures_per_mille` out of a thousand are invalid.
+    */
+   inline auto make_inputs(std::int64_t failures_per_mille) -> std::vector<std::uint32_t>
+   {
+      std::mt19937 engine{42}; // NOLINT
+      std::bernoulli_distribution dist{static_cast<double>(failures_per_mille) / 1000.0};
+
+      std::vector<std::uint32_t> inputs;
+      inputs.reserve(input_count);
+
+      for (std::size_t i = 0; i < input_count; ++i)
+      {
+         inputs.push_back(dist(engine) ? invalid_input : static_cast<std::uint32_t>(i) + 1);
+      }
+
+      return inputs;
+   }
+
+   /**
+    * @brief A payload of type `T` derived from `i`. Strings are too long for the small string
+    * optimization, so copying them allocates.
+    */
+   template <class T>
+   auto make_value(std::size_t i) -> T
+   {
+      if constexpr (std::is_same_v<T, std::string>)
+      {
+         return std::string(32, static_cast<char>('a' + i % 26)); // NOLINT
+      }
+      else
+      {
+         return static_cast<T>(i);
+      }
+   }
+
+   template <class T>
+   auto make_values() -> std::vector<T>
+   {
+      std::vector<T> values;
+      values.reserve(input_count);
+
+      for (std::size_t i = 0; i < input_count; ++i)
+      {
+         values.push_back(make_value<T>(i));
+      }
+
+      return values;
+   }
+
+   inline void set_items_processed(benchmark::State& state)
+   {
+      state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input_count));
+   }
+
+   /**
+    * @brief The failure rates, in failures per thousand inputs, used by propagation benchmarks.
+    */
+   inline void failure_rates(benchmark::internal::Benchmark* bench)
+   {
+      bench->ArgName("failures_per_mille")->Arg(0)->Arg(1)->Arg(10)->Arg(100)->Arg(500);
+   }
+
+   /**
+    * @brief The number of chained calls used by depth benchmarks.
+    */
+   inline void depths(benchmark::internal::Benchmark* bench)
+   {
+      bench->ArgName("depth")->Arg(1)->Arg(4)->Arg(16);
+   }
+} // namespace bench
+
+#endif // LIBREGLISSE_BENCH_INPUTS_HPP
@@ -0,0 +1,191 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/optional_view.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   /**
+    * @brief A payload large enough for every extra move to show up in the timings.
+    */
+   using payload = std::array<std::uint64_t, 16>; // NOLINT
+
+   constexpr std::size_t value_count = 1 << 12;
+
+   auto make_optionals() -> std::vector<std::optional<payload>>
+   {
+      std::mt19937 engine{42}; // NOLINT
+      std::bernoulli_distribution dist{0.5};
+
+      std::vector<std::optional<payload>> optionals;
+      optionals.reserve(value_count);
+
+      for (std::size_t i = 0; i < value_count; ++i)
+      {
+         if (dist(engine))
+         {
+            optionals.emplace_back(payload{i});
+         }
+         else
+         {
+            optionals.emplace_back(std::nullopt);
+         }
+      }
+
+      return optionals;
+   }
+
+   auto make_maybes() -> std::vector<maybe<payload>>
+   {
+      std::vector<maybe<payload>> maybes;
+      maybes.reserve(value_count);
+
+      for (auto& optional : make_optionals())
+      {
+         maybes.emplace_back(std::move(optional));
+      }
+
+      return maybes;
+   }
+
+   /**
+    * @brief The conversion written without the interop functions: the payload is moved out of
+    * the source, then into the wrapper.
+    */
+   auto rebuild_maybe(std::optional<payload>&& optional) -> maybe<payload>
+   {
+      if (optional.has_value())
+      {
+         return some(payload(std::move(*optional)));
+      }
+
+      return none;
+   }
+
+   auto rebuild_optional(maybe<payload>&& value) -> std::optional<payload>
+   {
+      if (value.is_some())
+      {
+         return std::optional<payload>(std::move(value).take());
+      }
+
+      return std::nullopt;
+   }
+} // namespace
+
+static void optional_to_maybe(benchmark::State& state)
+{
+   auto optionals = make_optionals();
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (auto& optional : optionals)
+      {
+         maybe<payload> value = std::move(optional);
+         benchmark::DoNotOptimize(value);
+         sum += value.is_some() ? value.borrow()[0] : 0;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * value_count));
+}
+BENCHMARK(optional_to_maybe);
+
+static void optional_to_maybe_rebuild(benchmark::State& state)
+{
+   auto optionals = make_optionals();
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (auto& optional : optionals)
+      {
+         maybe<payload> value = rebuild_maybe(std::move(optional));
+         benchmark::DoNotOptimize(value);
+         sum += value.is_some() ? value.borrow()[0] : 0;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * value_count));
+}
+BENCHMARK(optional_to_maybe_rebuild);
+
+static void maybe_to_optional(benchmark::State& state)
+{
+   auto maybes = make_maybes();
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (auto& value : maybes)
+      {
+         std::optional<payload> optional = std::move(value).to_optional();
+         benchmark::DoNotOptimize(optional);
+         sum += optional.has_value() ? (*optional)[0] : 0;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * value_count));
+}
+BENCHMARK(maybe_to_optional);
+
+static void maybe_to_optional_rebuild(benchmark::State& state)
+{
+   auto maybes = make_maybes();
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (auto& value : maybes)
+      {
+         std::optional<payload> optional = rebuild_optional(std::move(value));
+         benchmark::DoNotOptimize(optional);
+         sum += optional.has_value() ? (*optional)[0] : 0;
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * value_count));
+}
+BENCHMARK(maybe_to_optional_rebuild);
+
+static void optional_view_read(benchmark::State& state)
+{
+   auto optionals = make_optionals();
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (auto& optional : optionals)
+      {
+         sum += optional_view(optional).match(
+            [](const payload& value) {
+               return value[0];
+            },
+            [] {
+               return std::uint64_t{0};
+            });
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * value_count));
+}
+BENCHMARK(optional_view_read);
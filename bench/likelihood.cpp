@@ -0,0 +1,187 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+   /**
+    * @brief A parsed token, only the `Hinted` version tells the compiler that parsing succeeds.
+    */
+   template <bool Hinted>
+   struct token
+   {
+      std::uint32_t value;
+   };
+
+   /**
+    * @brief A cache entry, only the `Hinted` version tells the compiler that probes miss.
+    */
+   template <bool Hinted>
+   struct entry
+   {
+      std::uint64_t payload;
+   };
+
+   struct parse_error
+   {
+      std::uint32_t offset;
+   };
+} // namespace
+
+template <class Error, class Check>
+struct reglisse::expected_outcome<reglisse::result<token<true>, Error, Check>> :
+   reglisse::success_is_likely
+{
+};
+
+template <class Check>
+struct reglisse::expected_outcome<reglisse::maybe<entry<true>, Check>> :
+   reglisse::failure_is_likely
+{
+};
+
+using namespace reglisse;
+
+namespace
+{
+   constexpr std::size_t input_count = 1 << 20;
+
+   constexpr double parse_success_rate = 0.999;
+   constexpr double probe_hit_rate = 0.3;
+
+   constexpr std::uint32_t invalid_input = 0;
+
+   /**
+    * @brief Build inputs where a fraction `success_rate` are valid, either shuffled or with all
+    * the failures grouped at the end.
+    */
+   auto make_inputs(double success_rate, bool is_sorted) -> std::vector<std::uint32_t>
+   {
+      std::mt19937 engine{42}; // NOLINT
+      std::bernoulli_distribution dist{success_rate};
+
+      std::vector<std::uint32_t> inputs;
+      inputs.reserve(input_count);
+
+      for (std::size_t i = 0; i < input_count; ++i)
+      {
+         const bool is_valid = is_sorted
+            ? static_cast<double>(i) < success_rate * static_cast<double>(input_count)
+            : dist(engine);
+
+         inputs.push_back(is_valid ? static_cast<std::uint32_t>(i) + 1 : invalid_input);
+      }
+
+      return inputs;
+   }
+
+   template <bool Hinted>
+   auto parse(std::uint32_t input) -> result<token<Hinted>, parse_error>
+   {
+      if (input == invalid_input)
+      {
+         return err(parse_error{input});
+      }
+
+      return ok(token<Hinted>{input});
+   }
+
+   template <bool Hinted>
+   auto make_probes(bool is_sorted) -> std::vector<maybe<entry<Hinted>>>
+   {
+      std::vector<maybe<entry<Hinted>>> probes;
+      probes.reserve(input_count);
+
+      for (const std::uint32_t input : make_inputs(probe_hit_rate, is_sorted))
+      {
+         if (input == invalid_input)
+         {
+            probes.emplace_back(none);
+         }
+         else
+         {
+            probes.emplace_back(some(entry<Hinted>{input}));
+         }
+      }
+
+      return probes;
+   }
+
+   template <bool Hinted>
+   void parse_pipeline(benchmark::State& state)
+   {
+      const auto inputs = make_inputs(parse_success_rate, state.range(0) == 1);
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         std::uint64_t sum = 0;
+         for (const std::uint32_t input : inputs)
+         {
+            sum += parse<Hinted>(input)
+                      .transform([](token<Hinted> tok) {
+                         return tok.value * 3U;
+                      })
+                      .and_then([](std::uint32_t value) -> result<std::uint64_t, parse_error> {
+                         return ok(std::uint64_t{value} + 1);
+                      })
+                      .take_or(0U);
+         }
+
+         benchmark::DoNotOptimize(sum);
+      }
+
+      state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input_count));
+   }
+
+   template <bool Hinted>
+   void cache_probe(benchmark::State& state)
+   {
+      const auto probes = make_probes<Hinted>(state.range(0) == 1);
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         std::uint64_t sum = 0;
+         for (const auto& probe : probes)
+         {
+            sum += probe
+                      .transform([](const entry<Hinted>& hit) {
+                         return hit.payload ^ 0x5bd1e995U; // NOLINT
+                      })
+                      .take_or(1U);
+         }
+
+         benchmark::DoNotOptimize(sum);
+      }
+
+      state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input_count));
+   }
+} // namespace
+
+static void parse_unhinted(benchmark::State& state)
+{
+   parse_pipeline<false>(state);
+}
+BENCHMARK(parse_unhinted)->ArgName("sorted")->Arg(0)->Arg(1);
+
+static void parse_success_likely(benchmark::State& state)
+{
+   parse_pipeline<true>(state);
+}
+BENCHMARK(parse_success_likely)->ArgName("sorted")->Arg(0)->Arg(1);
+
+static void probe_unhinted(benchmark::State& state)
+{
+   cache_probe<false>(state);
+}
+BENCHMARK(probe_unhinted)->ArgName("sorted")->Arg(0)->Arg(1);
+
+static void probe_failure_likely(benchmark::State& state)
+{
+   cache_probe<true>(state);
+}
+BENCHMARK(probe_failure_likely)->ArgName("sorted")->Arg(0)->Arg(1);
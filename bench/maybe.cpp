@@ -0,0 +1,412 @@
+#include "inputs.hpp"
+
+#include <libreglisse/maybe.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   LIBREGLISSE_BENCH_NOINLINE auto maybe_step(std::uint32_t value) -> maybe<std::uint32_t>
+   {
+      if (value == bench::invalid_input)
+      {
+         return none;
+      }
+
+      return some(value * 3U + 1U);
+   }
+
+   LIBREGLISSE_BENCH_NOINLINE auto optional_step(std::uint32_t value)
+      -> std::optional<std::uint32_t>
+   {
+      if (value == bench::invalid_input)
+      {
+         return std::nullopt;
+      }
+
+      return value * 3U + 1U;
+   }
+
+   template <class T>
+   void maybe_construct(benchmark::State& state)
+   {
+      const auto values = bench::make_values<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            auto constructed = maybe<T>(std::in_place, value);
+            benchmark::DoNotOptimize(constructed);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void optional_construct(benchmark::State& state)
+   {
+      const auto values = bench::make_values<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            auto constructed = std::optional<T>(std::in_place, value);
+            benchmark::DoNotOptimize(constructed);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void maybe_copy(benchmark::State& state)
+   {
+      std::vector<maybe<T>> values;
+      for (auto& value : bench::make_values<T>())
+      {
+         values.emplace_back(std::in_place, std::move(value));
+      }
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            maybe<T> copy = value;
+            benchmark::DoNotOptimize(copy);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void optional_copy(benchmark::State& state)
+   {
+      std::vector<std::optional<T>> values;
+      for (auto& value : bench::make_values<T>())
+      {
+         values.emplace_back(std::in_place, std::move(value));
+      }
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            std::optional<T> copy = value;
+            benchmark::DoNotOptimize(copy);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   /**
+    * @brief Move every value out and back in, two moves per item.
+    */
+   template <class T>
+   void maybe_move(benchmark::State& state)
+   {
+      std::vector<maybe<T>> values;
+      for (auto& value : bench::make_values<T>())
+      {
+         values.emplace_back(std::in_place, std::move(value));
+      }
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (auto& value : values)
+         {
+            maybe<T> moved = std::move(value);
+            benchmark::DoNotOptimize(moved);
+            value = std::move(moved);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void optional_move(benchmark::State& state)
+   {
+      std::vector<std::optional<T>> values;
+      for (auto& value : bench::make_values<T>())
+      {
+         values.emplace_back(std::in_place, std::move(value));
+      }
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (auto& value : values)
+         {
+            std::optional<T> moved = std::move(value);
+            benchmark::DoNotOptimize(moved);
+            value = std::move(moved);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+} // namespace
+
+BENCHMARK_TEMPLATE(maybe_construct, std::uint64_t);
+BENCHMARK_TEMPLATE(optional_construct, std::uint64_t);
+BENCHMARK_TEMPLATE(maybe_construct, std::string);
+BENCHMARK_TEMPLATE(optional_construct, std::string);
+
+BENCHMARK_TEMPLATE(maybe_copy, std::uint64_t);
+BENCHMARK_TEMPLATE(optional_copy, std::uint64_t);
+BENCHMARK_TEMPLATE(maybe_copy, std::string);
+BENCHMARK_TEMPLATE(optional_copy, std::string);
+
+BENCHMARK_TEMPLATE(maybe_move, std::uint64_t);
+BENCHMARK_TEMPLATE(optional_move, std::uint64_t);
+BENCHMARK_TEMPLATE(maybe_move, std::string);
+BENCHMARK_TEMPLATE(optional_move, std::string);
+
+static void maybe_transform_chain(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = input == bench::invalid_input
+            ? maybe<std::uint32_t>(none)
+            : maybe<std::uint32_t>(some(std::uint32_t{input}));
+
+         sum += std::move(value)
+                   .transform([](std::uint32_t v) {
+                      return v * 3U;
+                   })
+                   .transform([](std::uint32_t v) {
+                      return std::uint64_t{v} + 7U;
+                   })
+                   .transform([](std::uint64_t v) {
+                      return v ^ 0x5bd1e995U; // NOLINT
+                   })
+                   .transform([](std::uint64_t v) {
+                      return v >> 1U;
+                   })
+                   .take_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(maybe_transform_chain)->Apply(bench::failure_rates);
+
+static void optional_transform_chain(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = input == bench::invalid_input ? std::optional<std::uint32_t>()
+                                                    : std::optional<std::uint32_t>(input);
+
+         std::optional<std::uint64_t> result;
+         if (value.has_value())
+         {
+            std::uint64_t v = std::uint64_t{*value * 3U} + 7U;
+            v ^= 0x5bd1e995U; // NOLINT
+            result = v >> 1U;
+         }
+
+         sum += result.value_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(optional_transform_chain)->Apply(bench::failure_rates);
+
+static void maybe_and_then_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = maybe<std::uint32_t>(some(std::uint32_t{input}));
+         for (std::int64_t i = 0; i < depth; ++i)
+         {
+            value = std::move(value).and_then(maybe_step);
+         }
+
+         sum += std::move(value).take_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(maybe_and_then_depth)->Apply(bench::depths);
+
+static void optional_and_then_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = std::optional<std::uint32_t>(input);
+         for (std::int64_t i = 0; i < depth and value.has_value(); ++i)
+         {
+            value = optional_step(*value);
+         }
+
+         sum += value.value_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(optional_and_then_depth)->Apply(bench::depths);
+
+static void maybe_take_or(benchmark::State& state)
+{
+   std::vector<maybe<std::string>> values;
+   for (const std::uint32_t input : bench::make_inputs(state.range(0)))
+   {
+      if (input == bench::invalid_input)
+      {
+         values.emplace_back(none);
+      }
+      else
+      {
+         values.emplace_back(std::in_place, bench::make_value<std::string>(input));
+      }
+   }
+
+   const std::string fallback = "fallback";
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::size_t sum = 0;
+      for (const auto& value : values)
+      {
+         sum += maybe<std::string>(value).take_or(fallback).size();
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(maybe_take_or)->Apply(bench::failure_rates);
+
+static void optional_value_or(benchmark::State& state)
+{
+   std::vector<std::optional<std::string>> values;
+   for (const std::uint32_t input : bench::make_inputs(state.range(0)))
+   {
+      if (input == bench::invalid_input)
+      {
+         values.emplace_back(std::nullopt);
+      }
+      else
+      {
+         values.emplace_back(std::in_place, bench::make_value<std::string>(input));
+      }
+   }
+
+   const std::string fallback = "fallback";
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::size_t sum = 0;
+      for (const auto& value : values)
+      {
+         sum += std::optional<std::string>(value).value_or(fallback).size();
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(optional_value_or)->Apply(bench::failure_rates);
+
+static void maybe_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         sum += maybe_step(input)
+                   .and_then(maybe_step)
+                   .and_then(maybe_step)
+                   .and_then(maybe_step)
+                   .take_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(maybe_propagation)->Apply(bench::failure_rates);
+
+static void optional_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = optional_step(input);
+         if (value.has_value())
+         {
+            value = optional_step(*value);
+         }
+         if (value.has_value())
+         {
+            value = optional_step(*value);
+         }
+         if (value.has_value())
+         {
+            value = optional_step(*value);
+         }
+
+         sum += value.value_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(optional_propagation)->Apply(bench::failure_rates);
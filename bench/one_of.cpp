@@ -0,0 +1,219 @@
+#include <libreglisse/either.hpp>
+#include <libreglisse/one_of.hpp>
+#include <libreglisse/overloaded.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <variant>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   struct ping
+   {
+      std::uint32_t id;
+   };
+
+   struct data
+   {
+      std::uint32_t size;
+      std::uint16_t channel;
+   };
+
+   struct ack
+   {
+      std::uint64_t seq;
+   };
+
+   struct close
+   {
+      std::uint8_t reason;
+   };
+
+   struct error
+   {
+      std::int32_t code;
+   };
+
+   const auto handler = overloaded{[](const ping& msg) -> std::uint64_t {
+                                      return msg.id;
+                                   },
+                                   [](const data& msg) -> std::uint64_t {
+                                      return msg.size * msg.channel;
+                                   },
+                                   [](const ack& msg) -> std::uint64_t {
+                                      return msg.seq + 1;
+                                   },
+                                   [](const close& msg) -> std::uint64_t {
+                                      return msg.reason;
+                                   },
+                                   [](const error& msg) -> std::uint64_t {
+                                      return static_cast<std::uint64_t>(-msg.code);
+                                   }};
+
+   constexpr std::size_t message_count = 1 << 20;
+
+   /**
+    * @brief Build the messages to dispatch on, either in random order or grouped by type.
+    */
+   template <class Variant, class Factory>
+   auto make_messages(Factory&& factory, bool is_sorted) -> std::vector<Variant>
+   {
+      std::mt19937 engine{42}; // NOLINT
+      std::uniform_int_distribution<std::uint32_t> dist{0, 4};
+
+      std::vector<Variant> messages;
+      messages.reserve(message_count);
+
+      for (std::size_t i = 0; i < message_count; ++i)
+      {
+         const auto kind = is_sorted ? static_cast<std::uint32_t>(i * 5 / message_count)
+                                     : dist(engine);
+
+         messages.push_back(factory(kind, static_cast<std::uint32_t>(i)));
+      }
+
+      return messages;
+   }
+
+   using one_of_msg = one_of<ping, data, ack, close, error>;
+   using variant_msg = std::variant<ping, data, ack, close, error>;
+   using nested_msg = either<ping, either<data, either<ack, either<close, error>>>>;
+
+   /**
+    * @brief Walk down the nested eithers until the message is found.
+    */
+   struct nested_handler
+   {
+      template <class Left, class Right>
+      auto operator()(const either<Left, Right>& msg) const -> std::uint64_t
+      {
+         return msg.match(*this, *this);
+      }
+
+      template <class Msg>
+      auto operator()(const Msg& msg) const -> std::uint64_t
+      {
+         return handler(msg);
+      }
+   };
+
+   auto make_one_of(std::uint32_t kind, std::uint32_t val) -> one_of_msg
+   {
+      switch (kind)
+      {
+         case 0:
+            return at<0>(ping{val});
+         case 1:
+            return at<1>(data{val, 2});
+         case 2:
+            return at<2>(ack{val});
+         case 3:
+            return at<3>(close{1});
+         default:
+            return at<4>(error{-1});
+      }
+   }
+
+   auto make_nested(std::uint32_t kind, std::uint32_t val) -> nested_msg
+   {
+      using inner_2 = either<close, error>;
+      using inner_1 = either<ack, inner_2>;
+      using inner_0 = either<data, inner_1>;
+
+      switch (kind)
+      {
+         case 0:
+            return left(ping{val});
+         case 1:
+            return right(inner_0(left(data{val, 2})));
+         case 2:
+            return right(inner_0(right(inner_1(left(ack{val})))));
+         case 3:
+            return right(inner_0(right(inner_1(right(inner_2(left(close{1})))))));
+         default:
+            return right(inner_0(right(inner_1(right(inner_2(right(error{-1})))))));
+      }
+   }
+
+   auto make_variant(std::uint32_t kind, std::uint32_t val) -> variant_msg
+   {
+      switch (kind)
+      {
+         case 0:
+            return ping{val};
+         case 1:
+            return data{val, 2};
+         case 2:
+            return ack{val};
+         case 3:
+            return close{1};
+         default:
+            return error{-1};
+      }
+   }
+} // namespace
+
+static void one_of_match(benchmark::State& state)
+{
+   const auto messages = make_messages<one_of_msg>(make_one_of, state.range(0) == 1);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const auto& msg : messages)
+      {
+         sum += msg.match(handler);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * message_count));
+   state.counters["bytes_per_message"] = sizeof(one_of_msg);
+}
+BENCHMARK(one_of_match)->ArgName("sorted")->Arg(0)->Arg(1);
+
+static void variant_visit(benchmark::State& state)
+{
+   const auto messages = make_messages<variant_msg>(make_variant, state.range(0) == 1);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const auto& msg : messages)
+      {
+         sum += std::visit(handler, msg);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * message_count));
+   state.counters["bytes_per_message"] = sizeof(variant_msg);
+}
+BENCHMARK(variant_visit)->ArgName("sorted")->Arg(0)->Arg(1);
+
+static void nested_either_match(benchmark::State& state)
+{
+   const auto messages = make_messages<nested_msg>(make_nested, state.range(0) == 1);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const auto& msg : messages)
+      {
+         sum += nested_handler{}(msg);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * message_count));
+   state.counters["bytes_per_message"] = sizeof(nested_msg);
+}
+BENCHMARK(nested_either_match)->ArgName("sorted")->Arg(0)->Arg(1);
@@ -0,0 +1,147 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   /**
+    * @brief A minimal growable array, doubling its capacity when full. Existing elements are
+    * either relocated or moved and destroyed one by one, like std::vector does.
+    */
+   template <class T, bool UseRelocate>
+   class growth_buffer
+   {
+   public:
+      growth_buffer() = default;
+      growth_buffer(const growth_buffer&) = delete;
+      growth_buffer(growth_buffer&&) = delete;
+      ~growth_buffer()
+      {
+         std::destroy(m_data, m_data + m_size);
+         m_alloc.deallocate(m_data, m_capacity);
+      }
+
+      auto operator=(const growth_buffer&) -> growth_buffer& = delete;
+      auto operator=(growth_buffer&&) -> growth_buffer& = delete;
+
+      void push_back(T&& value)
+      {
+         if (m_size == m_capacity)
+         {
+            grow();
+         }
+
+         std::construct_at(m_data + m_size, std::move(value));
+         ++m_size;
+      }
+
+      [[nodiscard]] auto data() const noexcept -> const T* { return m_data; }
+
+   private:
+      void grow()
+      {
+         const std::size_t new_capacity = m_capacity == 0 ? 16 : m_capacity * 2;
+
+         T* new_data = m_alloc.allocate(new_capacity);
+
+         if constexpr (UseRelocate)
+         {
+            relocate(m_data, m_data + m_size, new_data);
+         }
+         else
+         {
+            std::uninitialized_move(m_data, m_data + m_size, new_data);
+            std::destroy(m_data, m_data + m_size);
+         }
+
+         m_alloc.deallocate(m_data, m_capacity);
+
+         m_data = new_data;
+         m_capacity = new_capacity;
+      }
+
+   private:
+      std::allocator<T> m_alloc;
+
+      T* m_data = nullptr;
+      std::size_t m_size = 0;
+      std::size_t m_capacity = 0;
+   };
+
+   using maybe_ptr = maybe<std::unique_ptr<std::uint64_t>>;
+   using result_ptr = result<std::unique_ptr<std::uint64_t>, std::uint32_t>;
+
+   template <class T>
+   auto make_element(std::size_t i) -> T
+   {
+      if constexpr (std::same_as<T, maybe_ptr>)
+      {
+         return some(std::unique_ptr<std::uint64_t>());
+      }
+      else
+      {
+         if (i % 4 == 0)
+         {
+            return err(static_cast<std::uint32_t>(i));
+         }
+
+         return ok(std::unique_ptr<std::uint64_t>());
+      }
+   }
+
+   template <class T, bool UseRelocate>
+   void growth_buffer_push_back(benchmark::State& state)
+   {
+      const auto count = static_cast<std::size_t>(state.range(0));
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         growth_buffer<T, UseRelocate> buffer;
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            buffer.push_back(make_element<T>(i));
+         }
+
+         benchmark::DoNotOptimize(buffer.data());
+      }
+
+      state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+   }
+
+   template <class T>
+   void vector_push_back(benchmark::State& state)
+   {
+      const auto count = static_cast<std::size_t>(state.range(0));
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         std::vector<T> buffer;
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            buffer.push_back(make_element<T>(i));
+         }
+
+         benchmark::DoNotOptimize(buffer.data());
+      }
+
+      state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+   }
+} // namespace
+
+BENCHMARK_TEMPLATE(vector_push_back, maybe_ptr)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(growth_buffer_push_back, maybe_ptr, false)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(growth_buffer_push_back, maybe_ptr, true)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_TEMPLATE(vector_push_back, result_ptr)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(growth_buffer_push_back, result_ptr, false)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(growth_buffer_push_back, result_ptr, true)->Range(1 << 10, 1 << 18);
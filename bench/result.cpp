@@ -0,0 +1,504 @@
+#include "inputs.hpp"
+
+#include <libreglisse/result.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_expected)
+#   include <expected>
+#endif // defined(__cpp_lib_expected)
+
+using namespace reglisse;
+
+namespace
+{
+   struct parse_error
+   {
+      std::uint32_t input;
+   };
+
+   LIBREGLISSE_BENCH_NOINLINE auto result_step(std::uint32_t value)
+      -> result<std::uint32_t, parse_error>
+   {
+      if (value == bench::invalid_input)
+      {
+         return err(parse_error{value});
+      }
+
+      return ok(value * 3U + 1U);
+   }
+
+   template <class T>
+   auto make_results(std::int64_t failures_per_mille) -> std::vector<result<T, std::string>>
+   {
+      std::vector<result<T, std::string>> results;
+      results.reserve(bench::input_count);
+
+      for (const std::uint32_t input : bench::make_inputs(failures_per_mille))
+      {
+         if (input == bench::invalid_input)
+         {
+            results.push_back(make_err<T, std::string>("invalid input"));
+         }
+         else
+         {
+            results.push_back(make_ok<T, std::string>(bench::make_value<T>(input)));
+         }
+      }
+
+      return results;
+   }
+
+   template <class T>
+   void result_construct(benchmark::State& state)
+   {
+      const auto values = bench::make_values<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            auto constructed = result<T, std::string>(in_place_ok, value);
+            benchmark::DoNotOptimize(constructed);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void result_copy(benchmark::State& state)
+   {
+      const auto results = make_results<T>(0);
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : results)
+         {
+            result<T, std::string> copy = value;
+            benchmark::DoNotOptimize(copy);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   /**
+    * @brief Move every result out and back in, two moves per item.
+    */
+   template <class T>
+   void result_move(benchmark::State& state)
+   {
+      auto results = make_results<T>(0);
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (auto& value : results)
+         {
+            result<T, std::string> moved = std::move(value);
+            benchmark::DoNotOptimize(moved);
+            value = std::move(moved);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+} // namespace
+
+BENCHMARK_TEMPLATE(result_construct, std::uint64_t);
+BENCHMARK_TEMPLATE(result_construct, std::string);
+BENCHMARK_TEMPLATE(result_copy, std::uint64_t);
+BENCHMARK_TEMPLATE(result_copy, std::string);
+BENCHMARK_TEMPLATE(result_move, std::uint64_t);
+BENCHMARK_TEMPLATE(result_move, std::string);
+
+static void result_transform_chain(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = input == bench::invalid_input
+            ? result<std::uint32_t, parse_error>(err(parse_error{input}))
+            : result<std::uint32_t, parse_error>(ok(std::uint32_t{input}));
+
+         sum += std::move(value)
+                   .transform([](std::uint32_t v) {
+                      return v * 3U;
+                   })
+                   .transform([](std::uint32_t v) {
+                      return std::uint64_t{v} + 7U;
+                   })
+                   .transform([](std::uint64_t v) {
+                      return v ^ 0x5bd1e995U; // NOLINT
+                   })
+                   .transform([](std::uint64_t v) {
+                      return v >> 1U;
+                   })
+                   .take_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(result_transform_chain)->Apply(bench::failure_rates);
+
+static void result_and_then_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = result<std::uint32_t, parse_error>(ok(std::uint32_t{input}));
+         for (std::int64_t i = 0; i < depth; ++i)
+         {
+            value = std::move(value).and_then(result_step);
+         }
+
+         sum += std::move(value).take_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(result_and_then_depth)->Apply(bench::depths);
+
+static void result_take_or(benchmark::State& state)
+{
+   const auto results = make_results<std::string>(state.range(0));
+   const std::string fallback = "fallback";
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::size_t sum = 0;
+      for (const auto& value : results)
+      {
+         sum += result<std::string, std::string>(value).take_or(fallback).size();
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(result_take_or)->Apply(bench::failure_rates);
+
+static void result_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         sum += result_step(input)
+                   .and_then(result_step)
+                   .and_then(result_step)
+                   .and_then(result_step)
+                   .take_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(result_propagation)->Apply(bench::failure_rates);
+
+#if defined(__cpp_exceptions)
+
+namespace
+{
+   LIBREGLISSE_BENCH_NOINLINE auto throwing_step(std::uint32_t value) -> std::uint32_t
+   {
+      if (value == bench::invalid_input)
+      {
+         throw parse_error{value};
+      }
+
+      return value * 3U + 1U;
+   }
+} // namespace
+
+static void exception_and_then_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         try
+         {
+            std::uint32_t value = input;
+            for (std::int64_t i = 0; i < depth; ++i)
+            {
+               value = throwing_step(value);
+            }
+
+            sum += value;
+         }
+         catch (const parse_error&)
+         {}
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(exception_and_then_depth)->Apply(bench::depths);
+
+static void exception_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         try
+         {
+            sum += throwing_step(throwing_step(throwing_step(throwing_step(input))));
+         }
+         catch (const parse_error&)
+         {}
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(exception_propagation)->Apply(bench::failure_rates);
+
+#endif // defined(__cpp_exceptions)
+
+#if defined(__cpp_lib_expected)
+
+namespace
+{
+   LIBREGLISSE_BENCH_NOINLINE auto expected_step(std::uint32_t value)
+      -> std::expected<std::uint32_t, parse_error>
+   {
+      if (value == bench::invalid_input)
+      {
+         return std::unexpected(parse_error{value});
+      }
+
+      return value * 3U + 1U;
+   }
+
+   template <class T>
+   auto make_expecteds(std::int64_t failures_per_mille)
+      -> std::vector<std::expected<T, std::string>>
+   {
+      std::vector<std::expected<T, std::string>> expecteds;
+      expecteds.reserve(bench::input_count);
+
+      for (const std::uint32_t input : bench::make_inputs(failures_per_mille))
+      {
+         if (input == bench::invalid_input)
+         {
+            expecteds.emplace_back(std::unexpect, "invalid input");
+         }
+         else
+         {
+            expecteds.emplace_back(std::in_place, bench::make_value<T>(input));
+         }
+      }
+
+      return expecteds;
+   }
+
+   template <class T>
+   void expected_construct(benchmark::State& state)
+   {
+      const auto values = bench::make_values<T>();
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : values)
+         {
+            auto constructed = std::expected<T, std::string>(std::in_place, value);
+            benchmark::DoNotOptimize(constructed);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void expected_copy(benchmark::State& state)
+   {
+      const auto expecteds = make_expecteds<T>(0);
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (const auto& value : expecteds)
+         {
+            std::expected<T, std::string> copy = value;
+            benchmark::DoNotOptimize(copy);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+
+   template <class T>
+   void expected_move(benchmark::State& state)
+   {
+      auto expecteds = make_expecteds<T>(0);
+
+      for ([[maybe_unused]] auto _ : state)
+      {
+         for (auto& value : expecteds)
+         {
+            std::expected<T, std::string> moved = std::move(value);
+            benchmark::DoNotOptimize(moved);
+            value = std::move(moved);
+         }
+      }
+
+      bench::set_items_processed(state);
+   }
+} // namespace
+
+BENCHMARK_TEMPLATE(expected_construct, std::uint64_t);
+BENCHMARK_TEMPLATE(expected_construct, std::string);
+BENCHMARK_TEMPLATE(expected_copy, std::uint64_t);
+BENCHMARK_TEMPLATE(expected_copy, std::string);
+BENCHMARK_TEMPLATE(expected_move, std::uint64_t);
+BENCHMARK_TEMPLATE(expected_move, std::string);
+
+static void expected_transform_chain(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = input == bench::invalid_input
+            ? std::expected<std::uint32_t, parse_error>(std::unexpect, parse_error{input})
+            : std::expected<std::uint32_t, parse_error>(input);
+
+         std::expected<std::uint64_t, parse_error> transformed = std::unexpected(parse_error{});
+         if (value.has_value())
+         {
+            std::uint64_t v = std::uint64_t{*value * 3U} + 7U;
+            v ^= 0x5bd1e995U; // NOLINT
+            transformed = v >> 1U;
+         }
+
+         sum += transformed.value_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(expected_transform_chain)->Apply(bench::failure_rates);
+
+static void expected_and_then_depth(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(0);
+   const auto depth = state.range(0);
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = std::expected<std::uint32_t, parse_error>(input);
+         for (std::int64_t i = 0; i < depth and value.has_value(); ++i)
+         {
+            value = expected_step(*value);
+         }
+
+         sum += value.value_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(expected_and_then_depth)->Apply(bench::depths);
+
+static void expected_value_or(benchmark::State& state)
+{
+   const auto expecteds = make_expecteds<std::string>(state.range(0));
+   const std::string fallback = "fallback";
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::size_t sum = 0;
+      for (const auto& value : expecteds)
+      {
+         sum += std::expected<std::string, std::string>(value).value_or(fallback).size();
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(expected_value_or)->Apply(bench::failure_rates);
+
+static void expected_propagation(benchmark::State& state)
+{
+   const auto inputs = bench::make_inputs(state.range(0));
+
+   for ([[maybe_unused]] auto _ : state)
+   {
+      std::uint64_t sum = 0;
+      for (const std::uint32_t input : inputs)
+      {
+         auto value = expected_step(input);
+         if (value.has_value())
+         {
+            value = expected_step(*value);
+         }
+         if (value.has_value())
+         {
+            value = expected_step(*value);
+         }
+         if (value.has_value())
+         {
+            value = expected_step(*value);
+         }
+
+         sum += value.value_or(0U);
+      }
+
+      benchmark::DoNotOptimize(sum);
+   }
+
+   bench::set_items_processed(state);
+}
+BENCHMARK(expected_propagation)->Apply(bench::failure_rates);
+
+#endif // defined(__cpp_lib_expected)
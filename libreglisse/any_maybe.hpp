@@ -0,0 +1,221 @@
+/**
+ * @file any_maybe.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains any_maybe, a maybe whose value type is erased.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ANY_MAYBE_HPP
+#define LIBREGLISSE_ANY_MAYBE_HPP
+
+#include <libreglisse/detail/any_storage.hpp>
+#include <libreglisse/maybe.hpp>
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace reglisse
+{
+   /**
+    * @brief A maybe holding a value of any movable type.
+    *
+    * `any_maybe` only depends on its check policy, so a single set of monadic members serves
+    * every value type. It is meant for shared library interfaces and callbacks, where each
+    * distinct `maybe<T>` would otherwise be instantiated on both sides. Values that fit in three
+    * pointers are stored inline, larger values are allocated.
+    *
+    * The value type is given explicitly when accessing the value, accessing it with the wrong
+    * type goes through the check policy like accessing an empty maybe.
+    *
+    * @code
+    * auto find_plugin(std::string_view name) -> any_maybe;
+    *
+    * find_plugin("png").transform<plugin>(&plugin::version).to_maybe<int>();
+    * @endcode
+    *
+    * @tparam Check The policy called when the value is accessed on an empty maybe or as the wrong
+    * type.
+    */
+   template <check_policy Check = default_check>
+   class [[nodiscard]] basic_any_maybe
+   {
+   public:
+      using check_type = Check;
+
+   public:
+      basic_any_maybe() noexcept = default;
+      basic_any_maybe(none_t) noexcept {}
+      template <std::movable T>
+      basic_any_maybe(some<T>&& value)
+      {
+         m_storage.emplace<T>(std::move(value.value()));
+      }
+      /**
+       * @brief Erase the value type of `other`, moving its value, if any, exactly once.
+       */
+      template <std::movable T, check_policy OtherCheck>
+      basic_any_maybe(maybe<T, OtherCheck>&& other)
+      {
+         if (other.is_some())
+         {
+            m_storage.emplace<T>(std::move(other.borrow()));
+         }
+      }
+      /**
+       * @brief Create a maybe holding a value of type `T` constructed in place from `args`.
+       */
+      template <std::movable T, class... Args>
+         requires std::constructible_from<T, Args...>
+      explicit basic_any_maybe(std::in_place_type_t<T>, Args&&... args)
+      {
+         m_storage.emplace<T>(std::forward<Args>(args)...);
+      }
+
+      [[nodiscard]] auto is_some() const noexcept -> bool { return m_storage.has_value(); }
+      [[nodiscard]] auto is_none() const noexcept -> bool { return not is_some(); }
+      [[nodiscard]] explicit operator bool() const noexcept { return is_some(); }
+
+      /**
+       * @brief Whether the maybe holds a value of type `T`.
+       */
+      template <class T>
+      [[nodiscard]] auto holds() const noexcept -> bool
+      {
+         return m_storage.holds<T>();
+      }
+      /**
+       * @brief The type of the held value, `typeid(void)` if the maybe is empty.
+       */
+      [[nodiscard]] auto type() const noexcept -> const std::type_info& { return m_storage.type(); }
+
+      template <class T>
+      auto borrow() & -> T&
+      {
+         check_access<T>();
+
+         return m_storage.get<T>();
+      }
+      template <class T>
+      auto borrow() const& -> const T&
+      {
+         check_access<T>();
+
+         return m_storage.get<T>();
+      }
+      template <class T>
+      auto take() && -> T
+      {
+         check_access<T>();
+
+         return std::move(m_storage.get<T>());
+      }
+      template <class T, std::convertible_to<T> U>
+      auto take_or(U&& or_val) && -> T
+      {
+         if (is_some())
+         {
+            return std::move(*this).template take<T>();
+         }
+
+         return static_cast<T>(std::forward<U>(or_val));
+      }
+
+      template <class T, std::invocable<T&&> Fun>
+         requires std::movable<std::remove_cvref_t<std::invoke_result_t<Fun, T&&>>>
+      auto transform(Fun&& some_fun) && -> basic_any_maybe
+      {
+         if (is_some())
+         {
+            check_access<T>();
+
+            basic_any_maybe transformed;
+            transformed.m_storage.emplace_from<std::remove_cvref_t<std::invoke_result_t<Fun, T&&>>>(
+               std::forward<Fun>(some_fun), std::move(m_storage.get<T>()));
+
+            return transformed;
+         }
+
+         return none;
+      }
+      /**
+       * @brief Call `some_fun` with the held value. It may return an `any_maybe` or any `maybe`.
+       */
+      template <class T, std::invocable<T&&> Fun>
+         requires std::constructible_from<basic_any_maybe, std::invoke_result_t<Fun, T&&>>
+      auto and_then(Fun&& some_fun) && -> basic_any_maybe
+      {
+         if (is_some())
+         {
+            check_access<T>();
+
+            return basic_any_maybe(
+               std::invoke(std::forward<Fun>(some_fun), std::move(m_storage.get<T>())));
+         }
+
+         return none;
+      }
+      template <std::invocable Fun>
+         requires std::constructible_from<basic_any_maybe, std::invoke_result_t<Fun>>
+      auto or_else(Fun&& none_fun) && -> basic_any_maybe
+      {
+         if (is_some())
+         {
+            return std::move(*this);
+         }
+
+         return basic_any_maybe(std::invoke(std::forward<Fun>(none_fun)));
+      }
+
+      template <class T, std::invocable<T&&> Fun, std::invocable Def>
+      auto match(Fun&& some_fun, Def&& none_fun) && -> std::common_type_t<
+         std::invoke_result_t<Fun, T&&>, std::invoke_result_t<Def>>
+      {
+         if (is_some())
+         {
+            check_access<T>();
+
+            return std::invoke(std::forward<Fun>(some_fun), std::move(m_storage.get<T>()));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+      /**
+       * @brief Restore the value type, moving the value, if any, exactly once.
+       */
+      template <class T, check_policy MaybeCheck = check_type>
+      auto to_maybe() && -> maybe<T, MaybeCheck>
+      {
+         if (is_some())
+         {
+            check_access<T>();
+
+            return maybe<T, MaybeCheck>(std::in_place, std::move(m_storage.get<T>()));
+         }
+
+         return none;
+      }
+
+   private:
+      template <class T>
+      void check_access() const
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+         detail::handle_invalid_any_access<check_type>(m_storage.holds<T>());
+      }
+
+   private:
+      detail::any_storage m_storage;
+   };
+
+   /**
+    * @brief A basic_any_maybe using the default check policy.
+    */
+   using any_maybe = basic_any_maybe<>;
+} // namespace reglisse
+
+#endif // LIBREGLISSE_ANY_MAYBE_HPP
@@ -0,0 +1,311 @@
+/**
+ * @file any_result.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains any_result, a result whose value and error types are erased.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ANY_RESULT_HPP
+#define LIBREGLISSE_ANY_RESULT_HPP
+
+#include <libreglisse/detail/any_storage.hpp>
+#include <libreglisse/detail/from_invoke.hpp>
+#include <libreglisse/result.hpp>
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace reglisse
+{
+   /**
+    * @brief A result holding a value or an error of any movable types.
+    *
+    * `any_result` only depends on its check policy, so a single set of monadic members serves
+    * every value and error type. It is meant for shared library interfaces and callbacks, where
+    * each distinct `result<V, E>` would otherwise be instantiated on both sides. Payloads that fit
+    * in three pointers are stored inline, larger payloads are allocated.
+    *
+    * The value or error type is given explicitly when accessing the payload, accessing it with
+    * the wrong type goes through the check policy like accessing the wrong side.
+    *
+    * @code
+    * auto load(std::string_view path) -> any_result;
+    *
+    * load("a.png").transform<image>(&image::width).to_result<int, std::error_code>();
+    * @endcode
+    *
+    * @tparam Check The policy called when the payload is accessed on the wrong side or as the
+    * wrong type.
+    */
+   template <check_policy Check = default_check>
+   class [[nodiscard]] basic_any_result
+   {
+   public:
+      using check_type = Check;
+
+   public:
+      basic_any_result() = delete;
+      template <std::movable T>
+      basic_any_result(ok<T>&& value) : m_is_ok(true)
+      {
+         m_storage.emplace<T>(std::move(value.value()));
+      }
+      template <std::movable E>
+      basic_any_result(err<E>&& error) : m_is_ok(false)
+      {
+         m_storage.emplace<E>(std::move(error.value()));
+      }
+      /**
+       * @brief Erase the value and error types of `other`, moving its payload exactly once.
+       */
+      template <std::movable T, std::movable E, check_policy OtherCheck>
+      basic_any_result(result<T, E, OtherCheck>&& other) : m_is_ok(other.is_ok())
+      {
+         if (m_is_ok)
+         {
+            m_storage.emplace<T>(std::move(other.borrow()));
+         }
+         else
+         {
+            m_storage.emplace<E>(std::move(other.borrow_err()));
+         }
+      }
+      /**
+       * @brief Create a result holding a value of type `T` constructed in place from `args`.
+       */
+      template <std::movable T, class... Args>
+         requires std::constructible_from<T, Args...>
+      explicit basic_any_result(in_place_ok_t, std::in_place_type_t<T>, Args&&... args) :
+         m_is_ok(true)
+      {
+         m_storage.emplace<T>(std::forward<Args>(args)...);
+      }
+      /**
+       * @brief Create a result holding an error of type `E` constructed in place from `args`.
+       */
+      template <std::movable E, class... Args>
+         requires std::constructible_from<E, Args...>
+      explicit basic_any_result(in_place_err_t, std::in_place_type_t<E>, Args&&... args) :
+         m_is_ok(false)
+      {
+         m_storage.emplace<E>(std::forward<Args>(args)...);
+      }
+
+      [[nodiscard]] auto is_ok() const noexcept -> bool { return m_is_ok; }
+      [[nodiscard]] auto is_err() const noexcept -> bool { return not is_ok(); }
+      [[nodiscard]] explicit operator bool() const noexcept { return is_ok(); }
+
+      /**
+       * @brief Whether the result holds a value of type `T`.
+       */
+      template <class T>
+      [[nodiscard]] auto holds() const noexcept -> bool
+      {
+         return is_ok() and m_storage.holds<T>();
+      }
+      /**
+       * @brief Whether the result holds an error of type `E`.
+       */
+      template <class E>
+      [[nodiscard]] auto holds_err() const noexcept -> bool
+      {
+         return is_err() and m_storage.holds<E>();
+      }
+      /**
+       * @brief The type of the held value or error.
+       */
+      [[nodiscard]] auto type() const noexcept -> const std::type_info& { return m_storage.type(); }
+
+      template <class T>
+      auto borrow() & -> T&
+      {
+         check_value_access<T>();
+
+         return m_storage.get<T>();
+      }
+      template <class T>
+      auto borrow() const& -> const T&
+      {
+         check_value_access<T>();
+
+         return m_storage.get<T>();
+      }
+      template <class T>
+      auto take() && -> T
+      {
+         check_value_access<T>();
+
+         return std::move(m_storage.get<T>());
+      }
+      template <class T, std::convertible_to<T> U>
+      auto take_or(U&& other) && -> T
+      {
+         if (is_ok())
+         {
+            return std::move(*this).template take<T>();
+         }
+
+         return static_cast<T>(std::forward<U>(other));
+      }
+
+      template <class E>
+      auto borrow_err() & -> E&
+      {
+         check_error_access<E>();
+
+         return m_storage.get<E>();
+      }
+      template <class E>
+      auto borrow_err() const& -> const E&
+      {
+         check_error_access<E>();
+
+         return m_storage.get<E>();
+      }
+      template <class E>
+      auto take_err() && -> E
+      {
+         check_error_access<E>();
+
+         return std::move(m_storage.get<E>());
+      }
+
+      template <class T, std::invocable<T&&> Fun>
+         requires std::movable<std::remove_cvref_t<std::invoke_result_t<Fun, T&&>>>
+      auto transform(Fun&& fun) && -> basic_any_result
+      {
+         if (is_ok())
+         {
+            check_value_access<T>();
+
+            return basic_any_result(
+               detail::from_invoke, true, std::forward<Fun>(fun), std::move(m_storage.get<T>()));
+         }
+
+         return std::move(*this);
+      }
+      template <class E, std::invocable<E&&> Fun>
+         requires std::movable<std::remove_cvref_t<std::invoke_result_t<Fun, E&&>>>
+      auto transform_err(Fun&& err_fun) && -> basic_any_result
+      {
+         if (is_err())
+         {
+            check_error_access<E>();
+
+            return basic_any_result(detail::from_invoke, false, std::forward<Fun>(err_fun),
+                              std::move(m_storage.get<E>()));
+         }
+
+         return std::move(*this);
+      }
+      /**
+       * @brief Call `fun` with the held value. It may return an `any_result` or any `result`.
+       */
+      template <class T, std::invocable<T&&> Fun>
+         requires std::constructible_from<basic_any_result, std::invoke_result_t<Fun, T&&>>
+      auto and_then(Fun&& fun) && -> basic_any_result
+      {
+         if (is_ok())
+         {
+            check_value_access<T>();
+
+            return basic_any_result(
+               std::invoke(std::forward<Fun>(fun), std::move(m_storage.get<T>())));
+         }
+
+         return std::move(*this);
+      }
+      /**
+       * @brief Call `err_fun` with the held error. It may return an `any_result` or any `result`.
+       */
+      template <class E, std::invocable<E&&> Fun>
+         requires std::constructible_from<basic_any_result, std::invoke_result_t<Fun, E&&>>
+      auto or_else(Fun&& err_fun) && -> basic_any_result
+      {
+         if (is_err())
+         {
+            check_error_access<E>();
+
+            return basic_any_result(
+               std::invoke(std::forward<Fun>(err_fun), std::move(m_storage.get<E>())));
+         }
+
+         return std::move(*this);
+      }
+
+      template <class T, class E, std::invocable<T&&> OkFun, std::invocable<E&&> ErrFun>
+      auto match(OkFun&& ok_fun, ErrFun&& err_fun) && -> std::common_type_t<
+         std::invoke_result_t<OkFun, T&&>, std::invoke_result_t<ErrFun, E&&>>
+      {
+         if (is_ok())
+         {
+            check_value_access<T>();
+
+            return std::invoke(std::forward<OkFun>(ok_fun), std::move(m_storage.get<T>()));
+         }
+
+         check_error_access<E>();
+
+         return std::invoke(std::forward<ErrFun>(err_fun), std::move(m_storage.get<E>()));
+      }
+
+      /**
+       * @brief Restore the value and error types, moving the payload exactly once.
+       */
+      template <class T, class E, check_policy ResultCheck = check_type>
+      auto to_result() && -> result<T, E, ResultCheck>
+      {
+         if (is_ok())
+         {
+            check_value_access<T>();
+
+            return result<T, E, ResultCheck>(in_place_ok, std::move(m_storage.get<T>()));
+         }
+
+         check_error_access<E>();
+
+         return result<T, E, ResultCheck>(in_place_err, std::move(m_storage.get<E>()));
+      }
+
+   private:
+      /**
+       * @brief Create a result holding the value or error returned by `fun` when called with
+       * `args`.
+       */
+      template <class Fun, class... Args>
+      basic_any_result(detail::from_invoke_t, bool is_ok, Fun&& fun, Args&&... args) :
+         m_is_ok(is_ok)
+      {
+         m_storage.emplace_from<std::remove_cvref_t<std::invoke_result_t<Fun, Args...>>>(
+            std::forward<Fun>(fun), std::forward<Args>(args)...);
+      }
+
+      template <class T>
+      void check_value_access() const
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+         detail::handle_invalid_any_access<check_type>(m_storage.holds<T>());
+      }
+      template <class E>
+      void check_error_access() const
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+         detail::handle_invalid_any_access<check_type>(m_storage.holds<E>());
+      }
+
+   private:
+      detail::any_storage m_storage;
+      bool m_is_ok;
+   };
+
+   /**
+    * @brief A basic_any_result using the default check policy.
+    */
+   using any_result = basic_any_result<>;
+} // namespace reglisse
+
+#endif // LIBREGLISSE_ANY_RESULT_HPP
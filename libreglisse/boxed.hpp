@@ -0,0 +1,1413 @@
+/**
+ * @file boxed.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the boxed type used to store large payloads out of line.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_BOXED_HPP
+#define LIBREGLISSE_BOXED_HPP
+
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/binary_storage.hpp>
+#include <libreglisse/likelihood.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   struct box_access;
+
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_boxed_access(bool check)
+   {
+      Check::check(check, "boxed value was moved from");
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief Owns a single value allocated out of line, with value semantics.
+    *
+    * Copying a boxed copies the value, moving it only transfers the pointer. With a stateless
+    * allocator, a boxed is the size of a pointer, which keeps a `maybe` or `result` holding a
+    * large, rarely present payload small. Any allocator may be used, for instance a
+    * `std::pmr::polymorphic_allocator` backed by a pool.
+    *
+    * @tparam T The type of the value.
+    * @tparam Allocator The allocator used to allocate the value.
+    * @tparam Check The policy called when the value of a moved from box is accessed.
+    */
+   template <std::destructible T, class Allocator = std::allocator<T>,
+             check_policy Check = default_check>
+      requires(not std::is_reference_v<T>)
+   class boxed
+   {
+      using alloc_traits =
+         typename std::allocator_traits<Allocator>::template rebind_traits<T>;
+
+      friend struct detail::box_access;
+
+   public:
+      using value_type = T;
+      using allocator_type = typename alloc_traits::allocator_type;
+      using check_type = Check;
+
+   public:
+      /**
+       * @brief Box a value constructed in place from `args`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr explicit boxed(std::in_place_t, Args&&... args) :
+         m_ptr(allocate(std::forward<Args>(args)...))
+      {}
+      /**
+       * @brief Box a value constructed in place from `args`, using the allocator `alloc`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr boxed(std::allocator_arg_t, const allocator_type& alloc, Args&&... args) :
+         m_alloc(alloc), m_ptr(allocate(std::forward<Args>(args)...))
+      {}
+      constexpr explicit boxed(value_type&& value) : m_ptr(allocate(std::move(value))) {}
+      constexpr boxed(const boxed& other) requires std::copy_constructible<value_type> :
+         m_alloc(alloc_traits::select_on_container_copy_construction(other.m_alloc)),
+         m_ptr(other.m_ptr ? allocate(*other.m_ptr) : nullptr)
+      {}
+      constexpr boxed(boxed&& other) noexcept :
+         m_alloc(std::move(other.m_alloc)), m_ptr(std::exchange(other.m_ptr, nullptr))
+      {}
+      constexpr ~boxed() { release(); }
+
+      constexpr auto operator=(const boxed& rhs)
+         -> boxed& requires std::copy_constructible<value_type>
+      {
+         if (this != &rhs)
+         {
+            release();
+
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+            {
+               m_alloc = rhs.m_alloc;
+            }
+
+            m_ptr = rhs.m_ptr ? allocate(*rhs.m_ptr) : nullptr;
+         }
+
+         return *this;
+      }
+      constexpr auto operator=(boxed&& rhs) noexcept(
+         alloc_traits::propagate_on_container_move_assignment::value or
+         alloc_traits::is_always_equal::value) -> boxed&
+      {
+         if (this != &rhs)
+         {
+            release();
+
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+            {
+               m_alloc = std::move(rhs.m_alloc);
+               m_ptr = std::exchange(rhs.m_ptr, nullptr);
+            }
+            else
+            {
+               if (m_alloc == rhs.m_alloc)
+               {
+                  m_ptr = std::exchange(rhs.m_ptr, nullptr);
+               }
+               else
+               {
+                  m_ptr = rhs.m_ptr ? allocate(std::move(*rhs.m_ptr)) : nullptr;
+               }
+            }
+         }
+
+         return *this;
+      }
+
+      constexpr auto get() const& -> const value_type&
+      {
+         detail::handle_invalid_boxed_access<check_type>(m_ptr != nullptr);
+
+         return *m_ptr;
+      }
+      constexpr auto get() & -> value_type&
+      {
+         detail::handle_invalid_boxed_access<check_type>(m_ptr != nullptr);
+
+         return *m_ptr;
+      }
+      /**
+       * @brief Move the value out of the box.
+       */
+      constexpr auto take() && -> value_type
+      {
+         detail::handle_invalid_boxed_access<check_type>(m_ptr != nullptr);
+
+         return std::move(*m_ptr);
+      }
+
+      constexpr auto operator*() const& -> const value_type& { return get(); }
+      constexpr auto operator*() & -> value_type& { return get(); }
+      constexpr auto operator->() const -> const value_type* { return &get(); }
+      constexpr auto operator->() -> value_type* { return &get(); }
+
+      [[nodiscard]] constexpr auto get_allocator() const -> allocator_type { return m_alloc; }
+
+      template <class OtherAllocator, class OtherCheck>
+         requires std::equality_comparable<value_type>
+      constexpr auto operator==(const boxed<value_type, OtherAllocator, OtherCheck>& rhs) const
+         -> bool
+      {
+         return get() == rhs.get();
+      }
+
+   private:
+      /**
+       * @brief Create an empty box, as left by a move.
+       */
+      constexpr boxed(std::nullptr_t, const allocator_type& alloc) noexcept : m_alloc(alloc) {}
+
+      template <class... Args>
+      constexpr auto allocate(Args&&... args) -> value_type*
+      {
+         value_type* ptr = alloc_traits::allocate(m_alloc, 1);
+
+#if defined(__cpp_exceptions)
+         try
+         {
+            alloc_traits::construct(m_alloc, ptr, std::forward<Args>(args)...);
+         }
+         catch (...)
+         {
+            alloc_traits::deallocate(m_alloc, ptr, 1);
+            throw;
+         }
+#else
+         alloc_traits::construct(m_alloc, ptr, std::forward<Args>(args)...);
+#endif // defined(__cpp_exceptions)
+
+         return ptr;
+      }
+
+      constexpr void release()
+      {
+         if (m_ptr)
+         {
+            alloc_traits::destroy(m_alloc, m_ptr);
+            alloc_traits::deallocate(m_alloc, m_ptr, 1);
+
+            m_ptr = nullptr;
+         }
+      }
+
+   private:
+      [[no_unique_address]] allocator_type m_alloc{};
+
+      value_type* m_ptr = nullptr;
+   };
+
+   /**
+    * @brief A boxed using the default allocator only holds a pointer.
+    */
+   template <class T, class Check>
+   struct is_trivially_relocatable<boxed<T, std::allocator<T>, Check>> : std::true_type
+   {
+   };
+
+   /**
+    * @brief Box a value of type `T` constructed in place from `args`.
+    */
+   template <class T, class... Args>
+      requires std::constructible_from<T, Args...>
+   constexpr auto make_boxed(Args&&... args) -> boxed<T>
+   {
+      return boxed<T>(std::in_place, std::forward<Args>(args)...);
+   }
+
+   /**
+    * @brief Box a value of type `T` constructed in place from `args`, using the allocator `alloc`.
+    */
+   template <class T, class Allocator, class... Args>
+      requires std::constructible_from<T, Args...>
+   constexpr auto allocate_boxed(const Allocator& alloc, Args&&... args) -> boxed<T, Allocator>
+   {
+      return boxed<T, Allocator>(std::allocator_arg, alloc, std::forward<Args>(args)...);
+   }
+
+} // namespace reglisse
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Reaches the pointer of a boxed, for the wrappers using an empty box as their own
+    * empty state.
+    */
+   struct box_access
+   {
+      template <class Box>
+      static constexpr auto make_empty(const typename Box::allocator_type& alloc) noexcept -> Box
+      {
+         return Box(nullptr, alloc);
+      }
+
+      template <class T, class Allocator, class Check>
+      static constexpr auto is_empty(const boxed<T, Allocator, Check>& box) noexcept -> bool
+      {
+         return box.m_ptr == nullptr;
+      }
+
+      template <class T, class Allocator, class Check>
+      static constexpr auto value(boxed<T, Allocator, Check>& box) noexcept -> T&
+      {
+         return *box.m_ptr;
+      }
+      template <class T, class Allocator, class Check>
+      static constexpr auto value(const boxed<T, Allocator, Check>& box) noexcept -> const T&
+      {
+         return *box.m_ptr;
+      }
+
+      /**
+       * @brief Destroy the boxed value, if any, and box a new one constructed from `args`.
+       *
+       * The box is empty while the new value is being built, so it stays valid if that throws.
+       */
+      template <class T, class Allocator, class Check, class... Args>
+      static constexpr auto emplace(boxed<T, Allocator, Check>& box, Args&&... args) -> T&
+      {
+         box.release();
+         box.m_ptr = box.allocate(std::forward<Args>(args)...);
+
+         return *box.m_ptr;
+      }
+
+      template <class T, class Allocator, class Check>
+      static constexpr void reset(boxed<T, Allocator, Check>& box)
+      {
+         box.release();
+      }
+   };
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief A maybe whose value is boxed out of line.
+    *
+    * The maybe is empty when its box is, so with a stateless allocator it is the size of a
+    * pointer. Accessors and callables receive the value itself, never the box. A moved from
+    * maybe_box is empty. Like `maybe::transform` returns a `maybe`, `transform` returns a
+    * maybe_box, whose new value is boxed using the allocator of this one.
+    *
+    * @tparam T The type of the value.
+    * @tparam Allocator The allocator used to allocate the value.
+    * @tparam Check The policy called when the value is accessed on an empty maybe.
+    */
+   template <std::destructible T, class Allocator = std::allocator<T>,
+             check_policy Check = default_check>
+      requires(not std::is_reference_v<T>)
+   class [[nodiscard]] maybe_box
+   {
+      using box_type = boxed<T, Allocator, Check>;
+      using access = detail::box_access;
+
+   public:
+      using value_type = T;
+      using allocator_type = typename box_type::allocator_type;
+      using check_type = Check;
+
+   private:
+      template <class U>
+      using rebind =
+         maybe_box<U, typename std::allocator_traits<Allocator>::template rebind_alloc<U>,
+                   check_type>;
+
+   public:
+      /**
+       * @brief Create an empty monad.
+       */
+      constexpr maybe_box() noexcept : maybe_box(allocator_type()) {}
+      constexpr maybe_box(none_t) noexcept : maybe_box(allocator_type()) {}
+      /**
+       * @brief Create an empty monad, whose values will be allocated using `alloc`.
+       */
+      constexpr explicit maybe_box(const allocator_type& alloc) noexcept :
+         m_box(access::make_empty<box_type>(alloc))
+      {}
+      constexpr maybe_box(some<value_type>&& value) : m_box(std::move(value.value())) {}
+      /**
+       * @brief Take over an already allocated box, such as one from `allocate_boxed`.
+       */
+      constexpr maybe_box(some<box_type>&& box) noexcept : m_box(std::move(box.value())) {}
+      /**
+       * @brief Create a monad holding a value constructed in place from `args`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr explicit maybe_box(std::in_place_t, Args&&... args) :
+         m_box(std::in_place, std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create a monad holding a value constructed in place from `args`, allocated using
+       * `alloc`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr maybe_box(std::allocator_arg_t, const allocator_type& alloc, std::in_place_t,
+                          Args&&... args) :
+         m_box(std::allocator_arg, alloc, std::forward<Args>(args)...)
+      {}
+
+      constexpr auto borrow() & -> value_type&
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return access::value(m_box);
+      }
+      constexpr auto borrow() const& -> const value_type&
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return access::value(m_box);
+      }
+      constexpr auto take() && -> value_type
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return std::move(access::value(m_box));
+      }
+
+      template <std::convertible_to<value_type> U>
+      constexpr auto take_or(U&& or_val) && -> value_type
+      {
+         if (expect_some())
+         {
+            return std::move(access::value(m_box));
+         }
+
+         return static_cast<value_type>(std::forward<U>(or_val));
+      }
+      /**
+       * @brief Copy out the held value, or `or_val` if the maybe is empty. The box is kept.
+       */
+      template <std::convertible_to<value_type> U>
+         requires std::copy_constructible<value_type>
+      constexpr auto take_or(U&& or_val) const& -> value_type
+      {
+         if (expect_some())
+         {
+            return access::value(m_box);
+         }
+
+         return static_cast<value_type>(std::forward<U>(or_val));
+      }
+
+      /**
+       * @brief Destroy the held value, if any, and box a new one constructed from `args`.
+       *
+       * @return A reference to the newly constructed value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr auto emplace(Args&&... args) -> value_type&
+      {
+         return access::emplace(m_box, std::forward<Args>(args)...);
+      }
+
+      constexpr void reset() { access::reset(m_box); }
+
+      constexpr void swap(maybe_box& other) { std::swap(m_box, other.m_box); }
+
+      [[nodiscard]] constexpr auto is_some() const noexcept -> bool { return not is_none(); }
+      [[nodiscard]] constexpr auto is_none() const noexcept -> bool
+      {
+         return access::is_empty(m_box);
+      }
+      [[nodiscard]] constexpr operator bool() const noexcept { return is_some(); }
+
+      [[nodiscard]] constexpr auto get_allocator() const -> allocator_type
+      {
+         return m_box.get_allocator();
+      }
+
+      template <std::invocable<value_type&&> Fun>
+      constexpr auto transform(Fun&& some_fun) &&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&&>>>
+      {
+         using ret = rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&&>>>;
+
+         if (expect_some())
+         {
+            return ret(std::allocator_arg, rebound_allocator<ret>(), std::in_place,
+                       std::invoke(std::forward<Fun>(some_fun), std::move(access::value(m_box))));
+         }
+
+         return ret(rebound_allocator<ret>());
+      }
+      template <std::invocable<value_type&> Fun>
+      constexpr auto transform(Fun&& some_fun) &
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>>
+      {
+         using ret = rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>>;
+
+         if (expect_some())
+         {
+            return ret(std::allocator_arg, rebound_allocator<ret>(), std::in_place,
+                       std::invoke(std::forward<Fun>(some_fun), access::value(m_box)));
+         }
+
+         return ret(rebound_allocator<ret>());
+      }
+      template <std::invocable<const value_type&> Fun>
+      constexpr auto transform(Fun&& some_fun) const&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>>
+      {
+         using ret = rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>>;
+
+         if (expect_some())
+         {
+            return ret(std::allocator_arg, rebound_allocator<ret>(), std::in_place,
+                       std::invoke(std::forward<Fun>(some_fun), access::value(m_box)));
+         }
+
+         return ret(rebound_allocator<ret>());
+      }
+
+      template <std::invocable<value_type&&> Fun, class Other>
+      constexpr auto transform_or(Fun&& some_fun, Other&& other) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>, Other>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), std::move(access::value(m_box)));
+         }
+
+         return std::forward<Other>(other);
+      }
+      template <std::invocable<value_type&> Fun, class Other>
+      constexpr auto transform_or(Fun&& some_fun, Other&& other) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>, Other>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return std::forward<Other>(other);
+      }
+      template <std::invocable<const value_type&> Fun, class Other>
+      constexpr auto transform_or(Fun&& some_fun, Other&& other) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>, Other>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return std::forward<Other>(other);
+      }
+
+      template <std::invocable<value_type&&> Fun, std::invocable Def>
+         requires std::convertible_to<std::invoke_result_t<Fun, value_type&&>,
+                                      std::invoke_result_t<Def>>
+      constexpr auto transform_or_else(Fun&& some_fun,
+                                       Def&& none_fun) && -> std::invoke_result_t<Def>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), std::move(access::value(m_box)));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<value_type&> Fun, std::invocable Def>
+         requires std::convertible_to<std::invoke_result_t<Fun, value_type&>,
+                                      std::invoke_result_t<Def>>
+      constexpr auto transform_or_else(Fun&& some_fun,
+                                       Def&& none_fun) & -> std::invoke_result_t<Def>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<const value_type&> Fun, std::invocable Def>
+         requires std::convertible_to<std::invoke_result_t<Fun, const value_type&>,
+                                      std::invoke_result_t<Def>>
+      constexpr auto transform_or_else(Fun&& some_fun,
+                                       Def&& none_fun) const& -> std::invoke_result_t<Def>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+      template <std::invocable<value_type&&> Fun>
+      constexpr auto and_then(Fun&& some_fun) && -> std::invoke_result_t<Fun, value_type&&>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), std::move(access::value(m_box)));
+         }
+
+         return none;
+      }
+      template <std::invocable<value_type&> Fun>
+      constexpr auto and_then(Fun&& some_fun) & -> std::invoke_result_t<Fun, value_type&>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return none;
+      }
+      template <std::invocable<const value_type&> Fun>
+      constexpr auto and_then(Fun&& some_fun) const& -> std::invoke_result_t<Fun, const value_type&>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return none;
+      }
+
+      template <std::invocable Fun>
+      constexpr auto or_else(Fun&& none_fun) && -> maybe_box
+      {
+         if (expect_some())
+         {
+            return std::move(*this);
+         }
+
+         return std::invoke(std::forward<Fun>(none_fun));
+      }
+      template <std::invocable Fun>
+      constexpr auto or_else(Fun&& none_fun) const& -> maybe_box
+         requires std::copy_constructible<value_type>
+      {
+         if (expect_some())
+         {
+            return *this;
+         }
+
+         return std::invoke(std::forward<Fun>(none_fun));
+      }
+
+      /**
+       * @brief Call `fun` with the held value, or with `none` if the maybe is empty.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&> and std::invocable<Fun, none_t>)
+      constexpr auto match(Fun&& fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), access::value(m_box));
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, const value_type&> and std::invocable<Fun, none_t>)
+      constexpr auto match(Fun&& fun) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), access::value(m_box));
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&&> and std::invocable<Fun, none_t>)
+      constexpr auto match(Fun&& fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), std::move(access::value(m_box)));
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+
+      /**
+       * @brief Call `some_fun` with the held value, or `none_fun` if the maybe is empty.
+       */
+      template <std::invocable<value_type&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<const value_type&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) const& -> std::common_type_t<
+         std::invoke_result_t<Fun, const value_type&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_box));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<value_type&&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), std::move(access::value(m_box)));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+   private:
+      /**
+       * @brief The allocator of the maybe, rebound for the maybe_box `Ret`.
+       */
+      template <class Ret>
+      [[nodiscard]] constexpr auto rebound_allocator() const -> typename Ret::allocator_type
+      {
+         return typename Ret::allocator_type(get_allocator());
+      }
+
+      /**
+       * @brief `is_some()`, hinted with the `expected_outcome` of the maybe.
+       */
+      [[nodiscard]] constexpr auto expect_some() const noexcept -> bool
+      {
+         return detail::expect_success<expected_outcome_v<maybe_box>>(is_some());
+      }
+
+   private:
+      box_type m_box;
+   };
+
+   static_assert(sizeof(maybe_box<int>) == sizeof(void*),
+                 "an empty box is the empty state of maybe_box, it needs no flag");
+
+   /**
+    * @brief A maybe_box using the default allocator only holds a pointer.
+    */
+   template <class T, class Check>
+   struct is_trivially_relocatable<maybe_box<T, std::allocator<T>, Check>> : std::true_type
+   {
+   };
+
+   /**
+    * @brief Two maybe_box are equal if both are empty, or if they hold equal values.
+    */
+   template <class First, class FirstAllocator, class FirstCheck,
+             std::equality_comparable_with<First> Second, class SecondAllocator,
+             class SecondCheck>
+   constexpr auto operator==(const maybe_box<First, FirstAllocator, FirstCheck>& lhs,
+                             const maybe_box<Second, SecondAllocator, SecondCheck>& rhs) -> bool
+   {
+      if (lhs.is_some() != rhs.is_some())
+      {
+         return false;
+      }
+
+      if (lhs.is_none())
+      {
+         return true;
+      }
+
+      return lhs.borrow() == rhs.borrow();
+   }
+
+   template <class T, class Allocator, class Check>
+   constexpr auto operator==(const maybe_box<T, Allocator, Check>& m, none_t) noexcept -> bool
+   {
+      return m.is_none();
+   }
+
+   template <class T, class Allocator, class Check, class Other>
+   constexpr auto operator==(const maybe_box<T, Allocator, Check>& m,
+                             const Other& value) noexcept(noexcept(m.borrow() == value)) -> bool
+   {
+      return m.is_some() ? m.borrow() == value : false;
+   }
+
+   template <class First, class FirstAllocator, class FirstCheck, class Second,
+             class SecondAllocator, class SecondCheck>
+   constexpr auto operator<=>(const maybe_box<First, FirstAllocator, FirstCheck>& lhs,
+                              const maybe_box<Second, SecondAllocator, SecondCheck>& rhs)
+      -> std::compare_three_way_result_t<First, Second>
+   {
+      if (lhs.is_some() && rhs.is_some())
+      {
+         return lhs.borrow() <=> rhs.borrow();
+      }
+
+      return lhs.is_some() <=> rhs.is_some();
+   }
+
+   template <class T, class Allocator, class Check>
+   constexpr auto operator<=>(const maybe_box<T, Allocator, Check>& m, none_t) noexcept
+      -> std::strong_ordering
+   {
+      return m.is_some() <=> false;
+   }
+
+   template <class T, class Allocator, class Check, class Other>
+   constexpr auto operator<=>(const maybe_box<T, Allocator, Check>& m,
+                              const Other& value) noexcept(noexcept(m.borrow() <=> value))
+      -> std::compare_three_way_result_t<T, Other>
+   {
+      return m.is_some() ? m.borrow() <=> value : std::strong_ordering::less;
+   }
+
+   /**
+    * @brief A result whose value is boxed out of line. Useful when the value is large and the
+    * result usually holds an error.
+    *
+    * The result is as large as the larger of a pointer and `E`, plus the discriminant.
+    * Accessors and callables receive the value itself, never the box. Like the operations of
+    * `result` return a `result`, `transform` and `transform_err` return a result_box: a new value
+    * is boxed using the allocator of this one, a kept value keeps its box.
+    *
+    * A moved from result_box still holds a value, but its box is empty. Accessing that value
+    * calls the check policy.
+    *
+    * @tparam T The type of the value.
+    * @tparam E The type of the error.
+    * @tparam Allocator The allocator used to allocate the value.
+    * @tparam Check The policy called when the value or the error is accessed on the wrong side.
+    */
+   template <std::destructible T, std::destructible E, class Allocator = std::allocator<T>,
+             check_policy Check = default_check>
+      requires(not(std::is_reference_v<T> or std::is_reference_v<E>))
+   class [[nodiscard]] result_box
+   {
+      using box_type = boxed<T, Allocator, Check>;
+      using storage_type = detail::binary_storage<box_type, E>;
+      using access = detail::box_access;
+
+   public:
+      using value_type = T;
+      using error_type = E;
+      using allocator_type = typename box_type::allocator_type;
+      using check_type = Check;
+
+   private:
+      template <class OtherValue, class OtherError>
+      using rebind = result_box<
+         OtherValue, OtherError,
+         typename std::allocator_traits<Allocator>::template rebind_alloc<OtherValue>, check_type>;
+
+      template <class value_fun, class error_fun>
+      using join_result = std::common_type_t<std::invoke_result_t<value_fun, value_type>,
+                                             std::invoke_result_t<error_fun, error_type>>;
+
+      /**
+       * @brief The monad returned by `Fun`, or a `result` widening its error when it differs from
+       * `error_type`.
+       */
+      template <class Fun, class Value>
+      using and_then_result = std::conditional_t<
+         std::same_as<typename std::invoke_result_t<Fun, Value>::error_type, error_type>,
+         std::invoke_result_t<Fun, Value>,
+         result<typename std::invoke_result_t<Fun, Value>::value_type,
+                detail::widen_error_t<error_type,
+                                      typename std::invoke_result_t<Fun, Value>::error_type>,
+                typename std::invoke_result_t<Fun, Value>::check_type>>;
+
+   public:
+      constexpr result_box(ok<value_type>&& value) :
+         m_storage(std::in_place_index<0>, std::move(value.value()))
+      {}
+      /**
+       * @brief Take over an already allocated box, such as one from `allocate_boxed`.
+       */
+      constexpr result_box(ok<box_type>&& box) :
+         m_storage(std::in_place_index<0>, std::move(box.value()))
+      {}
+      constexpr result_box(err<error_type>&& error) :
+         m_storage(std::in_place_index<1>, std::move(error.value()))
+      {}
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr explicit result_box(in_place_ok_t, Args&&... args) :
+         m_storage(std::in_place_index<0>, std::in_place, std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create a result holding a value constructed in place from `args`, allocated using
+       * `alloc`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr result_box(std::allocator_arg_t, const allocator_type& alloc, in_place_ok_t,
+                           Args&&... args) :
+         m_storage(std::in_place_index<0>, std::allocator_arg, alloc, std::forward<Args>(args)...)
+      {}
+      template <class... Args>
+         requires std::constructible_from<error_type, Args...>
+      constexpr explicit result_box(in_place_err_t, Args&&... args) :
+         m_storage(std::in_place_index<1>, std::forward<Args>(args)...)
+      {}
+
+      constexpr void swap(result_box& other) requires std::move_constructible<error_type>
+      {
+         std::swap(m_storage, other.m_storage);
+      }
+
+      constexpr auto borrow() & -> value_type&
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return value();
+      }
+      constexpr auto borrow() const& -> const value_type&
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return value();
+      }
+      constexpr auto take() && -> value_type
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return std::move(value());
+      }
+
+      template <std::convertible_to<value_type> U>
+      constexpr auto take_or(U&& other) && -> value_type
+      {
+         if (expect_ok())
+         {
+            return std::move(value());
+         }
+
+         return std::forward<U>(other);
+      }
+      /**
+       * @brief Copy out the held value, or `other` if the result holds an error. The box is kept.
+       */
+      template <std::convertible_to<value_type> U>
+         requires std::copy_constructible<value_type>
+      constexpr auto take_or(U&& other) const& -> value_type
+      {
+         if (expect_ok())
+         {
+            return value();
+         }
+
+         return std::forward<U>(other);
+      }
+
+      constexpr auto borrow_err() & -> error_type&
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return m_storage.second();
+      }
+      constexpr auto borrow_err() const& -> const error_type&
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return m_storage.second();
+      }
+      constexpr auto take_err() && -> error_type
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return std::move(m_storage.second());
+      }
+
+      template <std::convertible_to<error_type> U>
+      constexpr auto take_err_or(U&& other) && -> error_type
+      {
+         if (not expect_ok())
+         {
+            return std::move(m_storage.second());
+         }
+
+         return std::forward<U>(other);
+      }
+      template <std::convertible_to<error_type> U>
+         requires std::copy_constructible<error_type>
+      constexpr auto take_err_or(U&& other) const& -> error_type
+      {
+         if (not expect_ok())
+         {
+            return m_storage.second();
+         }
+
+         return std::forward<U>(other);
+      }
+
+      /**
+       * @brief Destroy the held value or error and box a new value constructed from `args`.
+       *
+       * @return A reference to the newly constructed value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr auto emplace(Args&&... args) -> value_type&
+      {
+         if (is_ok())
+         {
+            return access::emplace(m_storage.first(), std::forward<Args>(args)...);
+         }
+
+         return access::value(m_storage.emplace_first(std::in_place, std::forward<Args>(args)...));
+      }
+      template <class... Args>
+         requires std::constructible_from<error_type, Args...>
+      constexpr auto emplace_err(Args&&... args) -> error_type&
+      {
+         return m_storage.emplace_second(std::forward<Args>(args)...);
+      }
+
+      [[nodiscard]] constexpr auto is_ok() const noexcept -> bool { return m_storage.is_first(); }
+      [[nodiscard]] constexpr auto is_err() const noexcept -> bool { return not is_ok(); }
+      constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+      /**
+       * @brief The allocator of the boxed value, or a default constructed one if the result holds
+       * an error.
+       */
+      [[nodiscard]] constexpr auto get_allocator() const -> allocator_type
+      {
+         return is_ok() ? m_storage.first().get_allocator() : allocator_type();
+      }
+
+      template <std::invocable<value_type&&> Fun>
+      constexpr auto transform(Fun&& fun) &&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&&>>, error_type>;
+
+         if (expect_ok())
+         {
+            return ret(std::allocator_arg, rebound_allocator<ret>(), in_place_ok,
+                       std::invoke(std::forward<Fun>(fun), std::move(value())));
+         }
+
+         return ret(in_place_err, std::move(m_storage.second()));
+      }
+      template <std::invocable<value_type&> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto transform(Fun&& fun) &
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>, error_type>;
+
+         if (expect_ok())
+         {
+            return ret(std::allocator_arg, rebound_allocator<ret>(), in_place_ok,
+                       std::invoke(std::forward<Fun>(fun), value()));
+         }
+
+         return ret(in_place_err, m_storage.second());
+      }
+      template <std::invocable<const value_type&> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto transform(Fun&& fun) const&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>;
+
+         if (expect_ok())
+         {
+            return ret(std::allocator_arg, rebound_allocator<ret>(), in_place_ok,
+                       std::invoke(std::forward<Fun>(fun), value()));
+         }
+
+         return ret(in_place_err, m_storage.second());
+      }
+
+      /**
+       * @brief Map the held error, if any. The boxed value, if any, is moved without being
+       * reallocated.
+       */
+      template <detail::ensure_error_mapper<error_type> Fun>
+      constexpr auto transform_err(Fun&& err_fun) &&
+         -> rebind<value_type, detail::map_error_result_t<Fun, error_type>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, error_type>>;
+
+         if (not expect_ok())
+         {
+            return ret(in_place_err, detail::map_error(std::forward<Fun>(err_fun),
+                                                       std::move(m_storage.second())));
+         }
+
+         return ret(ok(std::move(m_storage.first())));
+      }
+      /**
+       * @brief Map the held error, if any, without consuming the result. The value, if any, is
+       * copied into a new box.
+       */
+      template <detail::ensure_error_mapper<error_type&> Fun>
+         requires std::copy_constructible<value_type>
+      constexpr auto transform_err(Fun&& err_fun) &
+         -> rebind<value_type, detail::map_error_result_t<Fun, error_type&>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, error_type&>>;
+
+         if (not expect_ok())
+         {
+            return ret(in_place_err,
+                       detail::map_error(std::forward<Fun>(err_fun), m_storage.second()));
+         }
+
+         return ret(ok(box_type(m_storage.first())));
+      }
+      template <detail::ensure_error_mapper<const error_type&> Fun>
+         requires std::copy_constructible<value_type>
+      constexpr auto transform_err(Fun&& err_fun) const&
+         -> rebind<value_type, detail::map_error_result_t<Fun, const error_type&>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, const error_type&>>;
+
+         if (not expect_ok())
+         {
+            return ret(in_place_err,
+                       detail::map_error(std::forward<Fun>(err_fun), m_storage.second()));
+         }
+
+         return ret(ok(box_type(m_storage.first())));
+      }
+
+      /**
+       * @brief Chain a callable returning a result. When the error type of that result differs
+       * from `error_type`, both are widened as for `result::and_then`.
+       */
+      template <detail::ensure_value_result<value_type&&, error_type> Fun>
+      constexpr auto and_then(Fun&& fun) && -> and_then_result<Fun, value_type&&>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), std::move(value()));
+         }
+
+         using error = typename and_then_result<Fun, value_type&&>::error_type;
+
+         return err(error(std::move(m_storage.second())));
+      }
+      template <detail::ensure_value_result<value_type&, error_type> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto and_then(Fun&& fun) & -> and_then_result<Fun, value_type&>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         using error = typename and_then_result<Fun, value_type&>::error_type;
+
+         return err(error(m_storage.second()));
+      }
+      template <detail::ensure_value_result<const value_type&, error_type> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto and_then(Fun&& fun) const& -> and_then_result<Fun, const value_type&>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         using error = typename and_then_result<Fun, const value_type&>::error_type;
+
+         return err(error(m_storage.second()));
+      }
+
+      /**
+       * @brief Recover from the held error, if any. The boxed value, if any, is moved into the
+       * returned result without being reallocated.
+       */
+      template <std::invocable<error_type&&> Fun>
+         requires std::constructible_from<std::invoke_result_t<Fun, error_type&&>, ok<box_type>>
+      constexpr auto or_else(Fun&& err_fun) && -> std::invoke_result_t<Fun, error_type&&>
+      {
+         if (expect_ok())
+         {
+            return ok(std::move(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(err_fun), std::move(m_storage.second()));
+      }
+      /**
+       * @brief Recover from the held error, if any, without consuming the result. The value, if
+       * any, is copied into a new box.
+       */
+      template <std::invocable<error_type&> Fun>
+         requires(std::copy_constructible<value_type> and
+                  std::constructible_from<std::invoke_result_t<Fun, error_type&>, ok<box_type>>)
+      constexpr auto or_else(Fun&& err_fun) & -> std::invoke_result_t<Fun, error_type&>
+      {
+         if (expect_ok())
+         {
+            return ok(box_type(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(err_fun), m_storage.second());
+      }
+      template <std::invocable<const error_type&> Fun>
+         requires(std::copy_constructible<value_type> and
+                  std::constructible_from<std::invoke_result_t<Fun, const error_type&>,
+                                          ok<box_type>>)
+      constexpr auto or_else(Fun&& err_fun) const& -> std::invoke_result_t<Fun, const error_type&>
+      {
+         if (expect_ok())
+         {
+            return ok(box_type(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(err_fun), m_storage.second());
+      }
+
+      /**
+       * @brief Move out the value or the error, whichever is held.
+       */
+      template <class inner_value_ = value_type, class inner_error_ = error_type>
+      constexpr auto join() && -> std::common_type_t<inner_value_, inner_error_>
+      {
+         if (expect_ok())
+         {
+            return std::move(value());
+         }
+
+         return std::move(m_storage.second());
+      }
+
+      template <std::invocable<value_type> OkFun, std::invocable<error_type> ErrFun>
+      constexpr auto join(OkFun&& ok_fun, ErrFun&& err_fun) && -> join_result<OkFun, ErrFun>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), std::move(value()));
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), std::move(m_storage.second()));
+      }
+      template <std::invocable<const value_type&> OkFun, std::invocable<const error_type&> ErrFun>
+      constexpr auto join(OkFun&& ok_fun, ErrFun&& err_fun) const&
+         -> std::common_type_t<std::invoke_result_t<OkFun, const value_type&>,
+                               std::invoke_result_t<ErrFun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+
+      /**
+       * @brief Call `fun` with either the held value or the held error.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&> and std::invocable<Fun, error_type&>)
+      constexpr auto match(Fun&& fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>,
+                               std::invoke_result_t<Fun, error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, const value_type&> and
+                  std::invocable<Fun, const error_type&>)
+      constexpr auto match(Fun&& fun) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>,
+                               std::invoke_result_t<Fun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&&> and std::invocable<Fun, error_type&&>)
+      constexpr auto match(Fun&& fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>,
+                               std::invoke_result_t<Fun, error_type&&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), std::move(value()));
+         }
+
+         return std::invoke(std::forward<Fun>(fun), std::move(m_storage.second()));
+      }
+
+      /**
+       * @brief Call `ok_fun` with the held value, or `err_fun` with the held error.
+       */
+      template <std::invocable<value_type&> OkFun, std::invocable<error_type&> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) &
+         -> std::common_type_t<std::invoke_result_t<OkFun, value_type&>,
+                               std::invoke_result_t<ErrFun, error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+      template <std::invocable<const value_type&> OkFun,
+                std::invocable<const error_type&> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) const&
+         -> std::common_type_t<std::invoke_result_t<OkFun, const value_type&>,
+                               std::invoke_result_t<ErrFun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+      template <std::invocable<value_type&&> OkFun, std::invocable<error_type&&> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) &&
+         -> std::common_type_t<std::invoke_result_t<OkFun, value_type&&>,
+                               std::invoke_result_t<ErrFun, error_type&&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), std::move(value()));
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), std::move(m_storage.second()));
+      }
+
+   private:
+      /**
+       * @brief The boxed value, checked against the empty box left by a move.
+       */
+      constexpr auto value() & -> value_type& { return m_storage.first().get(); }
+      constexpr auto value() const& -> const value_type& { return m_storage.first().get(); }
+
+      /**
+       * @brief The allocator of the result, rebound for the result_box `Ret`.
+       */
+      template <class Ret>
+      [[nodiscard]] constexpr auto rebound_allocator() const -> typename Ret::allocator_type
+      {
+         return typename Ret::allocator_type(get_allocator());
+      }
+
+      /**
+       * @brief `is_ok()`, hinted with the `expected_outcome` of the result.
+       */
+      [[nodiscard]] constexpr auto expect_ok() const noexcept -> bool
+      {
+         return detail::expect_success<expected_outcome_v<result_box>>(is_ok());
+      }
+
+   private:
+      storage_type m_storage;
+   };
+
+   /**
+    * @brief A result_box using the default allocator is trivially relocatable if its error is.
+    */
+   template <class T, class E, class Check>
+   struct is_trivially_relocatable<result_box<T, E, std::allocator<T>, Check>> :
+      is_trivially_relocatable<E>
+   {
+   };
+
+   /**
+    * @brief Two result_box are equal if they hold equal values, or equal errors.
+    */
+   template <class FirstValue, class FirstError, class FirstAllocator, class FirstCheck,
+             std::equality_comparable_with<FirstValue> SecondValue,
+             std::equality_comparable_with<FirstError> SecondError, class SecondAllocator,
+             class SecondCheck>
+   constexpr auto
+   operator==(const result_box<FirstValue, FirstError, FirstAllocator, FirstCheck>& lhs,
+              const result_box<SecondValue, SecondError, SecondAllocator, SecondCheck>& rhs)
+      -> bool
+   {
+      if (lhs.is_ok() != rhs.is_ok())
+      {
+         return false;
+      }
+
+      if (lhs.is_ok())
+      {
+         return lhs.borrow() == rhs.borrow();
+      }
+
+      return lhs.borrow_err() == rhs.borrow_err();
+   }
+
+   template <class T, class E, class Allocator, class Check, std::equality_comparable_with<T> Other>
+   constexpr auto operator==(const result_box<T, E, Allocator, Check>& r, const ok<Other>& value)
+      -> bool
+   {
+      return r.is_ok() and r.borrow() == value.value();
+   }
+
+   template <class T, class E, class Allocator, class Check, std::equality_comparable_with<E> Other>
+   constexpr auto operator==(const result_box<T, E, Allocator, Check>& r, const err<Other>& error)
+      -> bool
+   {
+      return r.is_err() and r.borrow_err() == error.value();
+   }
+} // namespace reglisse
+
+namespace std // NOLINT
+{
+   template <class T, class Allocator, class Check>
+   constexpr void swap(reglisse::maybe_box<T, Allocator, Check>& lhs,
+                       reglisse::maybe_box<T, Allocator, Check>& rhs)
+   {
+      lhs.swap(rhs);
+   }
+
+   template <class T, class E, class Allocator, class Check>
+   constexpr void swap(reglisse::result_box<T, E, Allocator, Check>& lhs,
+                       reglisse::result_box<T, E, Allocator, Check>& rhs)
+   {
+      lhs.swap(rhs);
+   }
+} // namespace std
+
+#endif // LIBREGLISSE_BOXED_HPP
@@ -0,0 +1,295 @@
+/**
+ * @file c_abi.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Pass maybe and result to C code by value, through the structures of reglisse.h.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_C_ABI_HPP
+#define LIBREGLISSE_C_ABI_HPP
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/reglisse.h>
+#include <libreglisse/result.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Payloads that may be read and written by C code.
+    */
+   template <class T>
+   concept c_payload = std::is_trivially_copyable_v<T> and std::is_standard_layout_v<T>;
+
+   /**
+    * @brief Compares the layout of a C structure with the private layout of a monadic type.
+    */
+   struct c_layout
+   {
+      template <class CType, class T, class Check>
+      static consteval auto matches(std::type_identity<maybe<T, Check>> /*monad*/) -> bool
+      {
+         using type = maybe<T, Check>;
+
+         if constexpr (requires(CType c) {
+                          c.is_none;
+                          c.value;
+                       })
+         {
+            if constexpr (std::is_standard_layout_v<type>)
+            {
+               return std::same_as<decltype(CType::is_none), bool> and
+                  std::same_as<decltype(CType::value), T> and sizeof(CType) == sizeof(type) and
+                  alignof(CType) == alignof(type) and
+                  offsetof(CType, is_none) == offsetof(type, m_is_none) and
+                  offsetof(CType, value) == offsetof(type, m_value);
+            }
+         }
+
+         return false;
+      }
+
+      template <class CType, class V, class E, class Check>
+      static consteval auto matches(std::type_identity<result<V, E, Check>> /*monad*/) -> bool
+      {
+         using type = result<V, E, Check>;
+
+         if constexpr (not std::is_standard_layout_v<type>)
+         {
+            return false;
+         }
+         else if constexpr (std::same_as<V, E>)
+         {
+            if constexpr (requires(CType c) {
+                             c.payload;
+                             c.is_ok;
+                          })
+            {
+               return std::same_as<decltype(CType::is_ok), bool> and
+                  std::same_as<decltype(CType::payload), V> and sizeof(CType) == sizeof(type) and
+                  alignof(CType) == alignof(type) and
+                  offsetof(CType, payload) == offsetof(type, m_storage.m_value) and
+                  offsetof(CType, is_ok) == offsetof(type, m_storage.m_is_first);
+            }
+            else
+            {
+               return false;
+            }
+         }
+         else
+         {
+            if constexpr (requires(CType c) {
+                             c.is_ok;
+                             c.value;
+                             c.error;
+                          })
+            {
+               return std::same_as<decltype(CType::is_ok), bool> and
+                  std::same_as<decltype(CType::value), V> and
+                  std::same_as<decltype(CType::error), E> and sizeof(CType) == sizeof(type) and
+                  alignof(CType) == alignof(type) and
+                  offsetof(CType, is_ok) == offsetof(type, m_storage.m_is_first) and
+                  offsetof(CType, value) == offsetof(type, m_storage.m_first) and
+                  offsetof(CType, error) == offsetof(type, m_storage.m_second);
+            }
+            else
+            {
+               return false;
+            }
+         }
+      }
+   };
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief Whether the C structure `CType` has the exact layout of the monadic type `Monad`,
+    * field by field.
+    */
+   template <class CType, class Monad>
+   concept c_layout_of = std::is_standard_layout_v<CType> and
+      std::is_trivially_copyable_v<CType> and
+      detail::c_layout::matches<CType>(std::type_identity<Monad>());
+
+   /**
+    * @brief The C structure of reglisse.h mirroring `Monad`, if one is declared there.
+    */
+   template <class Monad>
+   struct c_abi_type
+   {
+   };
+
+   template <class Monad>
+   using c_abi_type_t = typename c_abi_type<Monad>::type;
+
+   template <class Check>
+   struct c_abi_type<maybe<std::int32_t, Check>>
+   {
+      using type = reglisse_maybe_i32;
+   };
+   template <class Check>
+   struct c_abi_type<maybe<std::int64_t, Check>>
+   {
+      using type = reglisse_maybe_i64;
+   };
+   template <class Check>
+   struct c_abi_type<maybe<std::uint32_t, Check>>
+   {
+      using type = reglisse_maybe_u32;
+   };
+   template <class Check>
+   struct c_abi_type<maybe<std::uint64_t, Check>>
+   {
+      using type = reglisse_maybe_u64;
+   };
+   template <class Check>
+   struct c_abi_type<maybe<double, Check>>
+   {
+      using type = reglisse_maybe_f64;
+   };
+   template <class Check>
+   struct c_abi_type<maybe<void*, Check>>
+   {
+      using type = reglisse_maybe_ptr;
+   };
+   template <class Check>
+   struct c_abi_type<result<std::int32_t, std::int32_t, Check>>
+   {
+      using type = reglisse_result_i32_i32;
+   };
+   template <class Check>
+   struct c_abi_type<result<std::int64_t, std::int32_t, Check>>
+   {
+      using type = reglisse_result_i64_i32;
+   };
+   template <class Check>
+   struct c_abi_type<result<std::uint64_t, std::int32_t, Check>>
+   {
+      using type = reglisse_result_u64_i32;
+   };
+   template <class Check>
+   struct c_abi_type<result<double, std::int32_t, Check>>
+   {
+      using type = reglisse_result_f64_i32;
+   };
+   template <class Check>
+   struct c_abi_type<result<void*, std::int32_t, Check>>
+   {
+      using type = reglisse_result_ptr_i32;
+   };
+
+   static_assert(c_layout_of<reglisse_maybe_i32, maybe<std::int32_t>>);
+   static_assert(c_layout_of<reglisse_maybe_i64, maybe<std::int64_t>>);
+   static_assert(c_layout_of<reglisse_maybe_u32, maybe<std::uint32_t>>);
+   static_assert(c_layout_of<reglisse_maybe_u64, maybe<std::uint64_t>>);
+   static_assert(c_layout_of<reglisse_maybe_f64, maybe<double>>);
+   static_assert(c_layout_of<reglisse_maybe_ptr, maybe<void*>>);
+
+   static_assert(c_layout_of<reglisse_result_i32_i32, result<std::int32_t, std::int32_t>>);
+   static_assert(c_layout_of<reglisse_result_i64_i32, result<std::int64_t, std::int32_t>>);
+   static_assert(c_layout_of<reglisse_result_u64_i32, result<std::uint64_t, std::int32_t>>);
+   static_assert(c_layout_of<reglisse_result_f64_i32, result<double, std::int32_t>>);
+   static_assert(c_layout_of<reglisse_result_ptr_i32, result<void*, std::int32_t>>);
+
+   /**
+    * @brief Copy a maybe into its C structure. The value is left zeroed when the maybe is empty.
+    */
+   template <class CType, detail::c_payload T, class Check>
+      requires c_layout_of<CType, maybe<T, Check>>
+   constexpr auto to_c(const maybe<T, Check>& m) noexcept -> CType
+   {
+      CType c{};
+      c.is_none = m.is_none();
+
+      if (m.is_some())
+      {
+         c.value = m.borrow();
+      }
+
+      return c;
+   }
+   template <detail::c_payload T, class Check>
+   constexpr auto to_c(const maybe<T, Check>& m) noexcept -> c_abi_type_t<maybe<T, Check>>
+   {
+      return to_c<c_abi_type_t<maybe<T, Check>>>(m);
+   }
+
+   /**
+    * @brief Copy a result into its C structure.
+    */
+   template <class CType, detail::c_payload V, detail::c_payload E, class Check>
+      requires c_layout_of<CType, result<V, E, Check>>
+   constexpr auto to_c(const result<V, E, Check>& r) noexcept -> CType
+   {
+      CType c{};
+      c.is_ok = r.is_ok();
+
+      if constexpr (std::same_as<V, E>)
+      {
+         c.payload = r.is_ok() ? r.borrow() : r.borrow_err();
+      }
+      else if (r.is_ok())
+      {
+         c.value = r.borrow();
+      }
+      else
+      {
+         c.error = r.borrow_err();
+      }
+
+      return c;
+   }
+   template <detail::c_payload V, detail::c_payload E, class Check>
+   constexpr auto to_c(const result<V, E, Check>& r) noexcept
+      -> c_abi_type_t<result<V, E, Check>>
+   {
+      return to_c<c_abi_type_t<result<V, E, Check>>>(r);
+   }
+
+   /**
+    * @brief Copy a C structure coming from C code into the monadic type `Monad`.
+    *
+    * Only the field selected by the discriminant is read.
+    */
+   template <class Monad, class CType>
+      requires c_layout_of<CType, Monad>
+   constexpr auto from_c(const CType& c) noexcept -> Monad
+   {
+      if constexpr (requires { c.is_none; })
+      {
+         if (c.is_none)
+         {
+            return Monad(none);
+         }
+
+         return Monad(std::in_place, c.value);
+      }
+      else if constexpr (requires { c.payload; })
+      {
+         if (c.is_ok)
+         {
+            return Monad(in_place_ok, c.payload);
+         }
+
+         return Monad(in_place_err, c.payload);
+      }
+      else
+      {
+         if (c.is_ok)
+         {
+            return Monad(in_place_ok, c.value);
+         }
+
+         return Monad(in_place_err, c.error);
+      }
+   }
+} // namespace reglisse
+
+#endif // LIBREGLISSE_C_ABI_HPP
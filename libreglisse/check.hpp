@@ -0,0 +1,152 @@
+/**
+ * @file check.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Policies deciding what happens when a monadic type is accessed on the wrong side.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_CHECK_HPP
+#define LIBREGLISSE_CHECK_HPP
+
+#if defined(__cpp_exceptions)
+#   include <libreglisse/detail/invalid_access_exception.hpp>
+
+#   include <exception>
+#endif // defined(__cpp_exceptions)
+
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__GNUC__)
+#   define LIBREGLISSE_COLD [[gnu::cold, gnu::noinline]]
+#else
+#   define LIBREGLISSE_COLD
+#endif // defined(__GNUC__)
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Print the message of a failed check, the only body writing to `stderr`.
+    */
+   LIBREGLISSE_COLD inline void report_invalid_access(const char* message) noexcept
+   {
+      std::fputs("libreglisse: invalid access: ", stderr);
+      std::fputs(message, stderr);
+      std::fputc('\n', stderr);
+   }
+
+   /**
+    * @brief The failure paths of the checks, kept out of line so that a checked accessor only
+    * costs a test and a jump at the call site.
+    */
+   LIBREGLISSE_COLD [[noreturn]] inline void assert_failure(const char* message) noexcept
+   {
+      report_invalid_access(message);
+      std::abort();
+   }
+
+   LIBREGLISSE_COLD [[noreturn]] inline void terminate_failure(const char* message) noexcept
+   {
+      report_invalid_access(message);
+#if defined(__cpp_exceptions)
+      std::terminate();
+#else
+      std::abort();
+#endif // defined(__cpp_exceptions)
+   }
+
+   LIBREGLISSE_COLD [[noreturn]] inline void throw_failure(const char* message)
+   {
+#if defined(__cpp_exceptions)
+      throw invalid_access_exception(message);
+#else
+      terminate_failure(message);
+#endif // defined(__cpp_exceptions)
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief A policy called by the checked accessors, `check(valid, message)` is only allowed to
+    * return when `valid` is true, unless the policy disables the checks.
+    */
+   template <class Policy>
+   concept check_policy = requires(bool valid, const char* message)
+   {
+      Policy::check(valid, message);
+   };
+
+   /**
+    * @brief Skip the checks entirely, accessing the wrong side is undefined behaviour.
+    */
+   struct no_check
+   {
+      static constexpr void check(bool /*valid*/, const char* /*message*/) noexcept {}
+   };
+
+   /**
+    * @brief Abort with a message on invalid accesses, unless `NDEBUG` is defined.
+    */
+   struct assert_check
+   {
+      static constexpr void check([[maybe_unused]] bool valid,
+                                  [[maybe_unused]] const char* message) noexcept
+      {
+#if !defined(NDEBUG)
+         if (not valid) [[unlikely]]
+         {
+            detail::assert_failure(message);
+         }
+#endif // !defined(NDEBUG)
+      }
+   };
+
+   /**
+    * @brief Call `std::terminate` on invalid accesses, in every build mode.
+    *
+    * When exceptions are disabled, `std::abort` is called instead, which is what the default
+    * terminate handler does, so that this header does not need `<exception>`.
+    */
+   struct terminate_check
+   {
+      static constexpr void check(bool valid, const char* message) noexcept
+      {
+         if (not valid) [[unlikely]]
+         {
+            detail::terminate_failure(message);
+         }
+      }
+   };
+
+   /**
+    * @brief Throw an `invalid_access_exception` on invalid accesses.
+    *
+    * When exceptions are disabled, the program is stopped instead, like `terminate_check`.
+    */
+   struct throw_check
+   {
+      static constexpr void check(bool valid, const char* message)
+      {
+         if (not valid) [[unlikely]]
+         {
+            detail::throw_failure(message);
+         }
+      }
+   };
+
+   /**
+    * @brief The policy used when none is given: `throw_check` when `LIBREGLISSE_USE_EXCEPTIONS`
+    * is defined, `assert_check` otherwise.
+    */
+#if defined(LIBREGLISSE_USE_EXCEPTIONS)
+   using default_check = throw_check;
+#else
+   using default_check = assert_check;
+#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+} // namespace reglisse
+
+#undef LIBREGLISSE_COLD
+
+#endif // LIBREGLISSE_CHECK_HPP
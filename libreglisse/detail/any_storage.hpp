@@ -0,0 +1,203 @@
+/**
+ * @file any_storage.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the type erased, small buffer optimized storage of any_maybe and any_result.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_ANY_STORAGE_HPP
+#define LIBREGLISSE_DETAIL_ANY_STORAGE_HPP
+
+#include <libreglisse/check.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace reglisse::detail
+{
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_any_access(bool check)
+   {
+      Check::check(check, "type does not match the erased payload");
+   }
+
+   inline constexpr std::size_t any_buffer_size = 3 * sizeof(void*);
+   inline constexpr std::size_t any_buffer_align = alignof(std::max_align_t);
+
+   /**
+    * @brief Payloads stored inline in the buffer, every other payload is allocated.
+    */
+   template <class T>
+   concept fits_any_buffer = sizeof(T) <= any_buffer_size and alignof(T) <= any_buffer_align and
+      std::is_nothrow_move_constructible_v<T>;
+
+   /**
+    * @brief The operations of an erased payload, one static instance per type.
+    */
+   struct any_vtable
+   {
+      const std::type_info* type;
+      void (*destroy)(void* buffer) noexcept;
+      /**
+       * @brief Move the payload of `src` into the empty buffer `dst` and destroy it in `src`.
+       */
+      void (*relocate)(void* dst, void* src) noexcept;
+   };
+
+   template <class T>
+   auto any_payload(void* buffer) noexcept -> T*
+   {
+      if constexpr (fits_any_buffer<T>)
+      {
+         return std::launder(static_cast<T*>(buffer));
+      }
+      else
+      {
+         return *static_cast<T**>(buffer);
+      }
+   }
+
+   template <class T>
+   inline constexpr any_vtable any_vtable_for{
+      .type = &typeid(T),
+      .destroy = [](void* buffer) noexcept {
+         if constexpr (fits_any_buffer<T>)
+         {
+            std::destroy_at(any_payload<T>(buffer));
+         }
+         else
+         {
+            delete any_payload<T>(buffer); // NOLINT
+         }
+      },
+      .relocate = [](void* dst, void* src) noexcept {
+         if constexpr (fits_any_buffer<T>)
+         {
+            ::new (dst) T(std::move(*any_payload<T>(src)));
+            std::destroy_at(any_payload<T>(src));
+         }
+         else
+         {
+            ::new (dst) T*(any_payload<T>(src));
+         }
+      }};
+
+   /**
+    * @brief Owns a single payload of any movable type, or nothing.
+    *
+    * Payloads of at most three pointers that are nothrow movable are stored inline, larger ones
+    * are allocated. The type of the payload is only known through its vtable, so none of the
+    * members of the storage depend on it.
+    */
+   class any_storage
+   {
+   public:
+      any_storage() noexcept = default;
+      any_storage(const any_storage&) = delete;
+      any_storage(any_storage&& other) noexcept : m_vtable(std::exchange(other.m_vtable, nullptr))
+      {
+         if (m_vtable)
+         {
+            m_vtable->relocate(m_buffer, other.m_buffer);
+         }
+      }
+      ~any_storage() { reset(); }
+
+      auto operator=(const any_storage&) -> any_storage& = delete;
+      auto operator=(any_storage&& rhs) noexcept -> any_storage&
+      {
+         if (this != &rhs)
+         {
+            reset();
+
+            m_vtable = std::exchange(rhs.m_vtable, nullptr);
+            if (m_vtable)
+            {
+               m_vtable->relocate(m_buffer, rhs.m_buffer);
+            }
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief Destroy the payload, if any, and store the value returned by `fun` when called
+       * with `args`. The value is constructed directly in its final location.
+       */
+      template <std::movable T, class Fun, class... Args>
+      void emplace_from(Fun&& fun, Args&&... args)
+      {
+         reset();
+
+         if constexpr (fits_any_buffer<T>)
+         {
+            ::new (static_cast<void*>(m_buffer))
+               T(std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...));
+         }
+         else
+         {
+            ::new (static_cast<void*>(m_buffer))
+               T*(new T(std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...)));
+         }
+
+         m_vtable = &any_vtable_for<T>;
+      }
+      template <std::movable T, class... Args>
+         requires std::constructible_from<T, Args...>
+      void emplace(Args&&... args)
+      {
+         emplace_from<T>(
+            []<class... Inner>(Inner&&... inner) {
+               return T(std::forward<Inner>(inner)...);
+            },
+            std::forward<Args>(args)...);
+      }
+
+      void reset() noexcept
+      {
+         if (m_vtable)
+         {
+            m_vtable->destroy(m_buffer);
+            m_vtable = nullptr;
+         }
+      }
+
+      [[nodiscard]] auto has_value() const noexcept -> bool { return m_vtable != nullptr; }
+      [[nodiscard]] auto type() const noexcept -> const std::type_info&
+      {
+         return m_vtable ? *m_vtable->type : typeid(void);
+      }
+      template <class T>
+      [[nodiscard]] auto holds() const noexcept -> bool
+      {
+         return m_vtable == &any_vtable_for<T> or (m_vtable and *m_vtable->type == typeid(T));
+      }
+
+      /**
+       * @brief The payload, which must be of type `T`.
+       */
+      template <class T>
+      auto get() noexcept -> T&
+      {
+         return *any_payload<T>(m_buffer);
+      }
+      template <class T>
+      auto get() const noexcept -> const T&
+      {
+         return *any_payload<T>(const_cast<std::byte*>(m_buffer)); // NOLINT
+      }
+
+   private:
+      alignas(any_buffer_align) std::byte m_buffer[any_buffer_size]{}; // NOLINT
+      const any_vtable* m_vtable = nullptr;
+   };
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_DETAIL_ANY_STORAGE_HPP
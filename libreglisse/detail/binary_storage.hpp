@@ -0,0 +1,388 @@
+/**
+ * @file detail/binary_storage.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Storage shared by the two sided monadic types, either and result.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_BINARY_STORAGE_HPP
+#define LIBREGLISSE_DETAIL_BINARY_STORAGE_HPP
+
+#include <libreglisse/detail/from_invoke.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   struct c_layout;
+
+   /**
+    * @brief Holds either a `First` or a `Second`, along with the side currently held.
+    *
+    * The first side is selected with `std::in_place_index<0>` and the second with
+    * `std::in_place_index<1>`.
+    */
+   template <class First, class Second>
+   class binary_storage
+   {
+      template <class OtherFirst, class OtherSecond>
+      friend class binary_storage;
+
+      friend struct c_layout;
+
+   public:
+      template <class... Args>
+      constexpr explicit binary_storage(std::in_place_index_t<0>, Args&&... args) :
+         m_is_first(true), m_first(std::forward<Args>(args)...)
+      {}
+      template <class... Args>
+      constexpr explicit binary_storage(std::in_place_index_t<1>, Args&&... args) :
+         m_is_first(false), m_second(std::forward<Args>(args)...)
+      {}
+      template <class Fun, class... Args>
+      constexpr binary_storage(from_invoke_t, std::in_place_index_t<0>, Fun&& fun,
+                               Args&&... args) :
+         m_is_first(true),
+         m_first(std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...))
+      {}
+      template <class Fun, class... Args>
+      constexpr binary_storage(from_invoke_t, std::in_place_index_t<1>, Fun&& fun,
+                               Args&&... args) :
+         m_is_first(false),
+         m_second(std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...))
+      {}
+      /**
+       * @brief Convert the storage of another pair of types, moving out the held side.
+       */
+      template <class OtherFirst, class OtherSecond>
+      constexpr explicit binary_storage(binary_storage<OtherFirst, OtherSecond>&& other) :
+         m_is_first(other.is_first())
+      {
+         if (is_first())
+         {
+            std::construct_at(&m_first, std::move(other.first())); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_second, std::move(other.second())); // NOLINT
+         }
+      }
+      constexpr binary_storage(const binary_storage& other) : m_is_first(other.is_first())
+      {
+         if (is_first())
+         {
+            std::construct_at(&m_first, other.first()); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_second, other.second()); // NOLINT
+         }
+      }
+      constexpr binary_storage(binary_storage&& other) noexcept(
+         std::is_nothrow_move_constructible_v<First> and
+         std::is_nothrow_move_constructible_v<Second>) :
+         m_is_first(other.is_first())
+      {
+         if (is_first())
+         {
+            std::construct_at(&m_first, std::move(other.first())); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_second, std::move(other.second())); // NOLINT
+         }
+      }
+      constexpr ~binary_storage() { destroy(); }
+
+      constexpr auto operator=(const binary_storage& rhs) -> binary_storage&
+      {
+         if (this != &rhs)
+         {
+            if (rhs.is_first())
+            {
+               emplace_first(rhs.first());
+            }
+            else
+            {
+               emplace_second(rhs.second());
+            }
+         }
+
+         return *this;
+      }
+      constexpr auto operator=(binary_storage&& rhs) noexcept(
+         std::is_nothrow_move_constructible_v<First> and
+         std::is_nothrow_move_constructible_v<Second>) -> binary_storage&
+      {
+         if (this != &rhs)
+         {
+            if (rhs.is_first())
+            {
+               emplace_first(std::move(rhs.first()));
+            }
+            else
+            {
+               emplace_second(std::move(rhs.second()));
+            }
+         }
+
+         return *this;
+      }
+
+      [[nodiscard]] constexpr auto is_first() const noexcept -> bool { return m_is_first; }
+
+      constexpr auto first() & noexcept -> First& { return m_first; }             // NOLINT
+      constexpr auto first() const& noexcept -> const First& { return m_first; } // NOLINT
+      constexpr auto second() & noexcept -> Second& { return m_second; }             // NOLINT
+      constexpr auto second() const& noexcept -> const Second& { return m_second; } // NOLINT
+
+      /**
+       * @brief Destroy the held side and construct the first one in place from `args`.
+       *
+       * The storage has no empty state to fall back to. A constructor that may throw builds the
+       * new value in a temporary first when it can then be moved in without throwing. Otherwise,
+       * see `replace`.
+       */
+      template <class... Args>
+      constexpr auto emplace_first(Args&&... args) -> First&
+      {
+         if constexpr (std::is_nothrow_constructible_v<First, Args...>)
+         {
+            destroy();
+            std::construct_at(&m_first, std::forward<Args>(args)...); // NOLINT
+         }
+         else if constexpr (std::is_nothrow_move_constructible_v<First>)
+         {
+            First value(std::forward<Args>(args)...);
+
+            destroy();
+            std::construct_at(&m_first, std::move(value)); // NOLINT
+         }
+         else
+         {
+            replace([&] {
+               std::construct_at(&m_first, std::forward<Args>(args)...); // NOLINT
+            });
+         }
+
+         m_is_first = true;
+
+         return m_first; // NOLINT
+      }
+      /**
+       * @brief Destroy the held side and construct the second one in place from `args`, with the
+       * same guarantees as `emplace_first`.
+       */
+      template <class... Args>
+      constexpr auto emplace_second(Args&&... args) -> Second&
+      {
+         if constexpr (std::is_nothrow_constructible_v<Second, Args...>)
+         {
+            destroy();
+            std::construct_at(&m_second, std::forward<Args>(args)...); // NOLINT
+         }
+         else if constexpr (std::is_nothrow_move_constructible_v<Second>)
+         {
+            Second value(std::forward<Args>(args)...);
+
+            destroy();
+            std::construct_at(&m_second, std::move(value)); // NOLINT
+         }
+         else
+         {
+            replace([&] {
+               std::construct_at(&m_second, std::forward<Args>(args)...); // NOLINT
+            });
+         }
+
+         m_is_first = false;
+
+         return m_second; // NOLINT
+      }
+
+   private:
+      /**
+       * @brief Destroy the held side and call `construct`.
+       *
+       * When the held side has a nothrow move, it is moved aside first and restored if
+       * `construct` throws. Otherwise, the held side is destroyed before `construct` runs, and an
+       * exception leaves the storage without a value, like assigning a result always did.
+       */
+      template <class Construct>
+      constexpr void replace(Construct&& construct)
+      {
+         if (is_first())
+         {
+            replace_held(m_first, construct); // NOLINT
+         }
+         else
+         {
+            replace_held(m_second, construct); // NOLINT
+         }
+      }
+      template <class Held, class Construct>
+      static constexpr void replace_held(Held& held, Construct& construct)
+      {
+         if constexpr (std::is_nothrow_move_constructible_v<Held>)
+         {
+            Held backup(std::move(held));
+
+            std::destroy_at(std::addressof(held));
+
+#if defined(__cpp_exceptions)
+            try
+            {
+               construct();
+            }
+            catch (...)
+            {
+               std::construct_at(std::addressof(held), std::move(backup));
+               throw;
+            }
+#else
+            construct();
+#endif // defined(__cpp_exceptions)
+         }
+         else
+         {
+            std::destroy_at(std::addressof(held));
+            construct();
+         }
+      }
+
+      constexpr void destroy()
+      {
+         if (is_first())
+         {
+            std::destroy_at(&m_first); // NOLINT
+         }
+         else
+         {
+            std::destroy_at(&m_second); // NOLINT
+         }
+      }
+
+   private:
+      bool m_is_first;
+
+      union
+      {
+         First m_first;
+         Second m_second;
+      };
+   };
+
+   /**
+    * @brief When both sides have the same type, a single value is stored and the side is only a
+    * flag.
+    *
+    * Copies and moves are those of the value, with no dispatch on the side, and switching sides
+    * is a bit flip.
+    */
+   template <class T>
+   class binary_storage<T, T>
+   {
+      template <class OtherFirst, class OtherSecond>
+      friend class binary_storage;
+
+      friend struct c_layout;
+
+   public:
+      template <std::size_t I, class... Args>
+      constexpr explicit binary_storage(std::in_place_index_t<I>, Args&&... args) :
+         m_value(std::forward<Args>(args)...), m_is_first(I == 0)
+      {}
+      template <std::size_t I, class Fun, class... Args>
+      constexpr binary_storage(from_invoke_t, std::in_place_index_t<I>, Fun&& fun,
+                               Args&&... args) :
+         m_value(std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...)),
+         m_is_first(I == 0)
+      {}
+      template <class OtherFirst, class OtherSecond>
+      constexpr explicit binary_storage(binary_storage<OtherFirst, OtherSecond>&& other) :
+         m_value(std::invoke([&]() -> T {
+            if (other.is_first())
+            {
+               return std::move(other.first());
+            }
+
+            return std::move(other.second());
+         })),
+         m_is_first(other.is_first())
+      {}
+
+      constexpr binary_storage(const binary_storage&) = default;
+      constexpr binary_storage(binary_storage&&) = default;
+      constexpr ~binary_storage() = default;
+
+      constexpr auto operator=(const binary_storage&) -> binary_storage& = default;
+      constexpr auto operator=(binary_storage&&) -> binary_storage& = default;
+
+      [[nodiscard]] constexpr auto is_first() const noexcept -> bool { return m_is_first; }
+
+      constexpr auto first() & noexcept -> T& { return m_value; }
+      constexpr auto first() const& noexcept -> const T& { return m_value; }
+      constexpr auto second() & noexcept -> T& { return m_value; }
+      constexpr auto second() const& noexcept -> const T& { return m_value; }
+
+      template <class... Args>
+      constexpr auto emplace_first(Args&&... args) -> T&
+      {
+         emplace(std::forward<Args>(args)...);
+         m_is_first = true;
+
+         return m_value;
+      }
+      template <class... Args>
+      constexpr auto emplace_second(Args&&... args) -> T&
+      {
+         emplace(std::forward<Args>(args)...);
+         m_is_first = false;
+
+         return m_value;
+      }
+
+      /**
+       * @brief Switch the side of the held value.
+       */
+      constexpr void flip() noexcept { m_is_first = not m_is_first; }
+
+   private:
+      template <class... Args>
+      constexpr void emplace(Args&&... args)
+      {
+         if constexpr (std::is_nothrow_constructible_v<T, Args...>)
+         {
+            std::destroy_at(&m_value);
+            std::construct_at(&m_value, std::forward<Args>(args)...);
+         }
+         else if constexpr (std::is_nothrow_move_constructible_v<T>)
+         {
+            T value(std::forward<Args>(args)...);
+
+            std::destroy_at(&m_value);
+            std::construct_at(&m_value, std::move(value));
+         }
+         else if constexpr (std::is_move_assignable_v<T>)
+         {
+            m_value = T(std::forward<Args>(args)...);
+         }
+         else
+         {
+            std::destroy_at(&m_value);
+            std::construct_at(&m_value, std::forward<Args>(args)...);
+         }
+      }
+
+   private:
+      T m_value;
+      bool m_is_first;
+   };
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_DETAIL_BINARY_STORAGE_HPP
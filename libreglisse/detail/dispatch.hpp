@@ -0,0 +1,102 @@
+/**
+ * @file detail/dispatch.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Runtime index to compile-time index dispatch used by the n-ary monadic types.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_DISPATCH_HPP
+#define LIBREGLISSE_DETAIL_DISPATCH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace reglisse::detail
+{
+   [[noreturn]] inline void unreachable()
+   {
+#if defined(_MSC_VER) && !defined(__clang__)
+      __assume(false);
+#else
+      __builtin_unreachable();
+#endif
+   }
+
+   template <std::size_t I>
+   using index_constant = std::integral_constant<std::size_t, I>;
+
+   template <class Ret, std::size_t I, std::size_t Count, class Fun>
+   constexpr auto dispatch_case(Fun&& fun) -> Ret
+   {
+      if constexpr (I < Count)
+      {
+         return std::invoke(std::forward<Fun>(fun), index_constant<I>{});
+      }
+      else
+      {
+         unreachable();
+      }
+   }
+
+   /**
+    * @brief Call `fun` with the `index_constant` matching `index`.
+    *
+    * The dispatch is done using a single dense `switch`, which compilers lower to a jump table.
+    * Indices are handled by blocks of 16, larger type lists simply chain multiple switches.
+    *
+    * @tparam Ret The return type of every call to `fun`.
+    * @tparam Count The number of valid indices.
+    */
+   template <class Ret, std::size_t Count, std::size_t Base = 0, class Fun>
+   constexpr auto dispatch(std::size_t index, Fun&& fun) -> Ret
+   {
+      switch (index - Base)
+      {
+         case 0:
+            return dispatch_case<Ret, Base + 0, Count>(std::forward<Fun>(fun));
+         case 1:
+            return dispatch_case<Ret, Base + 1, Count>(std::forward<Fun>(fun));
+         case 2:
+            return dispatch_case<Ret, Base + 2, Count>(std::forward<Fun>(fun));
+         case 3:
+            return dispatch_case<Ret, Base + 3, Count>(std::forward<Fun>(fun));
+         case 4:
+            return dispatch_case<Ret, Base + 4, Count>(std::forward<Fun>(fun));
+         case 5:
+            return dispatch_case<Ret, Base + 5, Count>(std::forward<Fun>(fun));
+         case 6:
+            return dispatch_case<Ret, Base + 6, Count>(std::forward<Fun>(fun));
+         case 7:
+            return dispatch_case<Ret, Base + 7, Count>(std::forward<Fun>(fun));
+         case 8:
+            return dispatch_case<Ret, Base + 8, Count>(std::forward<Fun>(fun));
+         case 9:
+            return dispatch_case<Ret, Base + 9, Count>(std::forward<Fun>(fun));
+         case 10:
+            return dispatch_case<Ret, Base + 10, Count>(std::forward<Fun>(fun));
+         case 11:
+            return dispatch_case<Ret, Base + 11, Count>(std::forward<Fun>(fun));
+         case 12:
+            return dispatch_case<Ret, Base + 12, Count>(std::forward<Fun>(fun));
+         case 13:
+            return dispatch_case<Ret, Base + 13, Count>(std::forward<Fun>(fun));
+         case 14:
+            return dispatch_case<Ret, Base + 14, Count>(std::forward<Fun>(fun));
+         case 15:
+            return dispatch_case<Ret, Base + 15, Count>(std::forward<Fun>(fun));
+         default:
+            if constexpr (Base + 16 < Count)
+            {
+               return dispatch<Ret, Count, Base + 16>(index, std::forward<Fun>(fun));
+            }
+            else
+            {
+               unreachable();
+            }
+      }
+   }
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_DETAIL_DISPATCH_HPP
@@ -0,0 +1,28 @@
+/**
+ * @file detail/from_invoke.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Tag used by the monadic types to construct their payload from the result of a callable.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_FROM_INVOKE_HPP
+#define LIBREGLISSE_DETAIL_FROM_INVOKE_HPP
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Selects the private constructors initializing the payload directly from the value
+    * returned by a callable.
+    *
+    * The returned prvalue initializes the storage of the monad, no temporary is materialized.
+    */
+   struct from_invoke_t
+   {
+      explicit from_invoke_t() = default;
+   };
+
+   inline constexpr auto from_invoke = from_invoke_t();
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_DETAIL_FROM_INVOKE_HPP
@@ -10,8 +10,6 @@
 #define LIBREGLISSE_UTILS_INVALID_ACCESS_EXCEPTION
 
 #include <exception>
-#include <string>
-#include <utility>
 
 namespace reglisse
 {
@@ -19,17 +17,18 @@ namespace reglisse
     * @brief A helper exception class used for error handling in monadic types
     *
     * The class is used when the macro `LIBREGLISSE_USE_EXCEPTIONS` is defined. It replaces the
-    * call to `assert()` with an exception throw.
+    * call to `assert()` with an exception throw. The message is not copied, it must outlive the
+    * exception, which holds for the string literals passed by the checks.
     */
    class invalid_access_exception : public std::exception
    {
    public:
-      invalid_access_exception(std::string msg) : m_msg(std::move(msg)) {}
+      invalid_access_exception(const char* msg) noexcept : m_msg(msg) {}
 
-      [[nodiscard]] auto what() const noexcept -> const char* override { return m_msg.c_str(); }
+      [[nodiscard]] auto what() const noexcept -> const char* override { return m_msg; }
 
    private:
-      std::string m_msg;
+      const char* m_msg;
    };
 } // namespace reglisse
 
@@ -0,0 +1,112 @@
+/**
+ * @file detail/variadic_union.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Dense storage shared by the n-ary monadic types.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_VARIADIC_UNION_HPP
+#define LIBREGLISSE_DETAIL_VARIADIC_UNION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   /**
+    * @brief The smallest unsigned integer type able to index `Count` alternatives.
+    */
+   template <std::size_t Count>
+   using smallest_index_t = std::conditional_t<
+      (Count <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+      std::conditional_t<(Count <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t,
+                         std::uint32_t>>;
+
+   template <class T, class... Ts>
+   inline constexpr bool is_one_of = (std::is_same_v<T, Ts> or ...);
+
+   template <class T, class... Ts>
+   struct index_of;
+
+   template <class T, class... Rest>
+   struct index_of<T, T, Rest...> : std::integral_constant<std::size_t, 0>
+   {
+   };
+
+   template <class T, class First, class... Rest>
+   struct index_of<T, First, Rest...> :
+      std::integral_constant<std::size_t, 1 + index_of<T, Rest...>::value>
+   {
+   };
+
+   template <class T, class... Ts>
+   inline constexpr std::size_t index_of_v = index_of<T, Ts...>::value;
+
+   template <std::size_t I, class... Ts>
+   using nth_type_t = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+   /**
+    * @brief A union of all the types in `Ts`, the active member has to be tracked externally.
+    *
+    * The union is built recursively so that only the alternative being constructed is ever
+    * activated, keeping it usable in constant expressions.
+    */
+   template <class... Ts>
+   union variadic_union
+   {
+   };
+
+   template <class First, class... Rest>
+   union variadic_union<First, Rest...>
+   {
+   public:
+      constexpr variadic_union() noexcept : m_dummy() {}
+
+      template <class... Args>
+      constexpr explicit variadic_union(std::in_place_index_t<0>, Args&&... args) :
+         m_head(std::forward<Args>(args)...)
+      {}
+
+      template <std::size_t I, class... Args>
+      constexpr explicit variadic_union(std::in_place_index_t<I>, Args&&... args) :
+         m_tail(std::in_place_index<I - 1>, std::forward<Args>(args)...)
+      {}
+
+      constexpr variadic_union(const variadic_union&) = default;
+      constexpr variadic_union(variadic_union&&) noexcept = default;
+      constexpr auto operator=(const variadic_union&) -> variadic_union& = default;
+      constexpr auto operator=(variadic_union&&) noexcept -> variadic_union& = default;
+
+      constexpr ~variadic_union() requires(std::is_trivially_destructible_v<First> and
+                                           (std::is_trivially_destructible_v<Rest> and ...)) =
+         default;
+      constexpr ~variadic_union() {}
+
+      std::byte m_dummy;
+      First m_head;
+      variadic_union<Rest...> m_tail;
+   };
+
+   /**
+    * @brief Access the `I`th alternative of a variadic_union, preserving the value category.
+    */
+   template <std::size_t I, class Union>
+   constexpr auto get(Union&& storage) noexcept -> decltype(auto)
+   {
+      if constexpr (I == 0)
+      {
+         return (std::forward<Union>(storage).m_head);
+      }
+      else
+      {
+         return get<I - 1>(std::forward<Union>(storage).m_tail);
+      }
+   }
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_DETAIL_VARIADIC_UNION_HPP
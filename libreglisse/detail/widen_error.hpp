@@ -0,0 +1,52 @@
+/**
+ * @file detail/widen_error.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Error type of a result chained with a result of another error type.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_WIDEN_ERROR_HPP
+#define LIBREGLISSE_DETAIL_WIDEN_ERROR_HPP
+
+namespace reglisse::detail
+{
+   template <class Error>
+   inline constexpr bool is_error_union = false;
+
+   template <class... Ts>
+   inline constexpr bool dependent_false = false;
+
+   /**
+    * @brief The error type able to hold both `First` and `Second` when they differ, defined by
+    * `libreglisse/error_union.hpp`.
+    */
+   template <class First, class Second, class = void>
+   struct widened_error
+   {
+      static_assert(dependent_false<First, Second>,
+                    "include <libreglisse/error_union.hpp> to chain results with different error "
+                    "types");
+   };
+
+   template <class First, class Second>
+   struct widen_error_select : widened_error<First, Second>
+   {
+   };
+
+   template <class Error>
+   struct widen_error_select<Error, Error>
+   {
+      using type = Error;
+   };
+
+   /**
+    * @brief The error type able to hold both `First` and `Second`.
+    *
+    * Identical error types are kept as is without pulling in error_union.
+    */
+   template <class First, class Second>
+   using widen_error_t = typename widen_error_select<First, Second>::type;
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_DETAIL_WIDEN_ERROR_HPP
@@ -9,48 +9,35 @@
 #ifndef LIBREGLISSE_EITHER_HPP
 #define LIBREGLISSE_EITHER_HPP
 
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-#   include <libreglisse/detail/invalid_access_exception.hpp>
-#else
-#   include <cassert>
-#endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/binary_storage.hpp>
+#include <libreglisse/detail/from_invoke.hpp>
+#include <libreglisse/relocate.hpp>
 
-#include <algorithm>
 #include <concepts>
+#include <functional>
+#include <memory>
+#include <utility>
 
 namespace reglisse::detail
 {
-   inline void handle_invalid_left_either_access(bool check)
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_left_either_access(bool check)
    {
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-      if (!check)
-      {
-         throw invalid_access_exception("value stored on right side of either");
-      }
-#else
-      assert(check && "value stored on right side of either"); // NOLINT
-#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+      Check::check(check, "value stored on right side of either");
    }
 
-   inline void handle_invalid_right_either_access(bool check)
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_right_either_access(bool check)
    {
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-      if (!check)
-      {
-         throw invalid_access_exception("value stored on left side of either");
-      }
-#else
-      assert(check && "value stored on left side of either");  // NOLINT
-#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+      Check::check(check, "value stored on left side of either");
    }
 
-   // clang-format off
-
    template <typename Fun, typename T>
    concept ensure_either = std::invocable<Fun, T> && requires
    {
-      { std::invoke_result_t<Fun, T>::left_type };
-      { std::invoke_result_t<Fun, T>::right_type };
+      typename std::invoke_result_t<Fun, T>::left_type;
+      typename std::invoke_result_t<Fun, T>::right_type;
    };
 
    template <typename Fun, typename LeftType, typename RightType>
@@ -68,19 +55,40 @@ namespace reglisse::detail
 
 namespace reglisse
 {
-   template <std::movable LeftType, std::movable RightType>
+   /**
+    * @brief Tag used to construct the left value of an either in place.
+    */
+   struct in_place_left_t
+   {
+      explicit in_place_left_t() = default;
+   };
+
+   inline constexpr auto in_place_left = in_place_left_t();
+
+   /**
+    * @brief Tag used to construct the right value of an either in place.
+    */
+   struct in_place_right_t
+   {
+      explicit in_place_right_t() = default;
+   };
+
+   inline constexpr auto in_place_right = in_place_right_t();
+
+   template <std::destructible LeftType, std::destructible RightType,
+             check_policy Check = default_check>
       requires(not(std::is_reference_v<LeftType> or std::is_reference_v<RightType>))
    class either;
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class left;
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class right;
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class left
    {
@@ -111,7 +119,7 @@ namespace reglisse
       value_type m_value;
    };
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class right
    {
@@ -142,210 +150,339 @@ namespace reglisse
       value_type m_value;
    };
 
-   template <std::movable L, std::movable R>
+   /**
+    * @brief Holds a value of one of two types.
+    *
+    * @tparam L The type of the left value.
+    * @tparam R The type of the right value.
+    * @tparam Check The policy called when a value is accessed on the wrong side.
+    */
+   template <std::destructible L, std::destructible R, check_policy Check>
       requires(not(std::is_reference_v<L> or std::is_reference_v<R>))
    class either
    {
+      template <std::destructible LeftType, std::destructible RightType,
+                check_policy OtherCheck>
+         requires(not(std::is_reference_v<LeftType> or std::is_reference_v<RightType>))
+      friend class either;
+
    public:
       using left_type = L;
       using right_type = R;
+      using check_type = Check;
+
+   private:
+      template <class OtherLeft, class OtherRight>
+      using rebind = either<OtherLeft, OtherRight, check_type>;
 
    public:
       constexpr either() = delete;
-      constexpr either(left<left_type>&& left_val)
+      constexpr either(left<left_type>&& left_val) :
+         m_storage(std::in_place_index<0>, std::move(left_val).value())
+      {}
+      constexpr either(right<right_type>&& right_val) :
+         m_storage(std::in_place_index<1>, std::move(right_val).value())
+      {}
+      /**
+       * @brief Create an either holding a left value constructed in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the left value.
+       */
+      template <class... Args>
+         requires std::constructible_from<left_type, Args...>
+      constexpr explicit either(in_place_left_t, Args&&... args) :
+         m_storage(std::in_place_index<0>, std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create an either holding a right value constructed in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the right value.
+       */
+      template <class... Args>
+         requires std::constructible_from<right_type, Args...>
+      constexpr explicit either(in_place_right_t, Args&&... args) :
+         m_storage(std::in_place_index<1>, std::forward<Args>(args)...)
+      {}
+      constexpr either(const either&) requires(
+         std::copy_constructible<left_type> and std::copy_constructible<right_type>) = default;
+      constexpr either(either&&) requires(
+         std::move_constructible<left_type> and std::move_constructible<right_type>) = default;
+      constexpr ~either() = default;
+
+      constexpr auto operator=(const either&) -> either& requires(
+         std::copy_constructible<left_type> and std::copy_constructible<right_type>) = default;
+      constexpr auto operator=(either&&) -> either& requires(
+         std::move_constructible<left_type> and std::move_constructible<right_type>) = default;
+
+      constexpr void swap(either& other) requires(
+         std::swappable<left_type> and std::swappable<right_type>)
       {
-         std::construct_at(&m_left, std::move(left_val).value()); // NOLINT
+         std::swap(m_storage, other.m_storage);
       }
-      constexpr either(right<right_type>&& right_val) : m_is_left(false)
+
+      constexpr auto borrow_left() const& -> const left_type&
       {
-         std::construct_at(&m_right, std::move(right_val.value())); // NOLINT
+         detail::handle_invalid_left_either_access<check_type>(is_left());
+
+         return m_storage.first();
       }
-      constexpr either(const either& other) : m_is_left(other.is_left())
+      constexpr auto borrow_left() & -> left_type&
       {
-         if (is_left())
-         {
-            std::construct_at(&m_left, other.borrow_left()); // NOLINT
-         }
-         else
-         {
-            std::construct_at(&m_right, other.borrow_right()); // NOLINT
-         }
+         detail::handle_invalid_left_either_access<check_type>(is_left());
+
+         return m_storage.first();
       }
-      constexpr either(either&& other) noexcept : m_is_left(other.is_left())
+      constexpr auto take_left() const&& -> const left_type
       {
-         if (is_left())
-         {
-            std::construct_at(&m_left, other.take_left()); // NOLINT
-         }
-         else
-         {
-            std::construct_at(&m_right, other.take_right()); // NOLINT
-         }
+         detail::handle_invalid_left_either_access<check_type>(is_left());
+
+         return std::move(m_storage.first());
       }
-      constexpr ~either()
+      constexpr auto take_left() && -> left_type
       {
-         if (is_left())
-         {
-            std::destroy_at(&m_left); // NOLINT
-         }
-         else
-         {
-            std::destroy_at(&m_right); // NOLINT
-         }
+         detail::handle_invalid_left_either_access<check_type>(is_left());
+
+         return std::move(m_storage.first());
       }
 
-      constexpr auto operator=(const either& rhs) -> either&
+      constexpr auto borrow_right() const& -> const right_type&
       {
-         if (this != &rhs)
-         {
-            if (is_left())
-            {
-               std::destroy_at(&m_left); // NOLINT
-            }
-            else
-            {
-               std::destroy_at(&m_right); // NOLINT
-            }
+         detail::handle_invalid_right_either_access<check_type>(is_right());
 
-            m_is_left = rhs.m_is_left;
-
-            if (is_left())
-            {
-               std::construct_at(&m_left, rhs.borrow_left()); // NOLINT
-            }
-            else
-            {
-               std::construct_at(&m_right, rhs.borrow_right()); // NOLINT
-            }
-         }
-
-         return *this;
+         return m_storage.second();
       }
-      constexpr auto operator=(either&& rhs) noexcept -> either&
+      constexpr auto borrow_right() & -> right_type&
       {
-         if (this != &rhs)
-         {
-            if (is_left())
-            {
-               std::destroy_at(&m_left); // NOLINT
-            }
-            else
-            {
-               std::destroy_at(&m_right); // NOLINT
-            }
-
-            m_is_left = rhs.m_is_left;
-
-            if (is_left())
-            {
-               std::construct_at(&m_left, std::move(rhs).take_left()); // NOLINT
-            }
-            else
-            {
-               std::construct_at(&m_right, std::move(rhs).take_right()); // NOLINT
-            }
-         }
+         detail::handle_invalid_right_either_access<check_type>(is_right());
 
-         return *this;
+         return m_storage.second();
       }
-
-      constexpr auto borrow_left() const& noexcept -> const left_type&
+      constexpr auto take_right() const&& -> const right_type
       {
-         detail::handle_invalid_left_either_access(is_left());
+         detail::handle_invalid_right_either_access<check_type>(is_right());
 
-         return m_left; // NOLINT
+         return std::move(m_storage.second());
       }
-      constexpr auto borrow_left() & noexcept -> left_type&
+      constexpr auto take_right() && -> right_type
       {
-         detail::handle_invalid_left_either_access(is_left());
+         detail::handle_invalid_right_either_access<check_type>(is_right());
 
-         return m_left; // NOLINT
+         return std::move(m_storage.second());
       }
-      constexpr auto take_left() const&& noexcept -> const left_type
-      {
-         detail::handle_invalid_left_either_access(is_left());
 
-         return std::move(m_left); // NOLINT
+      /**
+       * @brief Destroy the held value and construct a new left value in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the left value.
+       *
+       * @return A reference to the newly constructed left value.
+       */
+      template <class... Args>
+         requires std::constructible_from<left_type, Args...>
+      constexpr auto emplace_left(Args&&... args) -> left_type&
+      {
+         return m_storage.emplace_first(std::forward<Args>(args)...);
       }
-      constexpr auto take_left() && noexcept -> left_type
+      /**
+       * @brief Destroy the held value and construct a new right value in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the right value.
+       *
+       * @return A reference to the newly constructed right value.
+       */
+      template <class... Args>
+         requires std::constructible_from<right_type, Args...>
+      constexpr auto emplace_right(Args&&... args) -> right_type&
       {
-         detail::handle_invalid_left_either_access(is_left());
-
-         return std::move(m_left); // NOLINT
+         return m_storage.emplace_second(std::forward<Args>(args)...);
       }
 
-      constexpr auto borrow_right() const& noexcept -> const right_type&
-      {
-         detail::handle_invalid_right_either_access(is_right());
+      [[nodiscard]] constexpr auto is_left() const noexcept -> bool { return m_storage.is_first(); }
+      [[nodiscard]] constexpr auto is_right() const noexcept -> bool { return !is_left(); }
 
-         return m_right; // NOLINT
-      }
-      constexpr auto borrow_right() & noexcept -> right_type&
+      /**
+       * @brief Move the held value to the opposite side.
+       *
+       * When both sides have the same type, the value stays in place and only the side flag
+       * changes.
+       */
+      constexpr auto swap_sides() && -> rebind<right_type, left_type>
+         requires(std::move_constructible<left_type> and std::move_constructible<right_type>)
       {
-         detail::handle_invalid_right_either_access(is_right());
+         if constexpr (std::same_as<left_type, right_type>)
+         {
+            m_storage.flip();
+
+            return std::move(*this);
+         }
+         else
+         {
+            using ret = rebind<right_type, left_type>;
+
+            if (is_left())
+            {
+               return ret(in_place_right, std::move(m_storage.first()));
+            }
 
-         return m_right; // NOLINT
+            return ret(in_place_left, std::move(m_storage.second()));
+         }
       }
-      constexpr auto take_right() const&& noexcept -> const right_type
+      /**
+       * @brief Move the held value to the opposite side in place, for an either whose sides have
+       * the same type. Only the side flag changes, the value is neither moved nor copied.
+       */
+      constexpr void swap_sides() & noexcept requires std::same_as<left_type, right_type>
       {
-         detail::handle_invalid_right_either_access(is_right());
+         m_storage.flip();
+      }
 
-         return std::move(m_right); // NOLINT
+      /**
+       * @brief Access the value of an either whose sides have the same type, whichever side
+       * holds it.
+       *
+       * Both sides share the same storage, the side of the either is never tested.
+       */
+      constexpr auto join() const& noexcept -> const left_type&
+         requires std::same_as<left_type, right_type>
+      {
+         return m_storage.first();
       }
-      constexpr auto take_right() && noexcept -> right_type
+      constexpr auto join() && -> left_type requires std::same_as<left_type, right_type>
       {
-         detail::handle_invalid_right_either_access(is_right());
-
-         return std::move(m_right); // NOLINT
+         return std::move(m_storage.first());
       }
 
-      [[nodiscard]] constexpr auto is_left() const noexcept -> bool { return m_is_left; }
-      [[nodiscard]] constexpr auto is_right() const noexcept -> bool { return !is_left(); }
-
       template <std::invocable<left_type> Fun>
       constexpr auto transform_left(
-         Fun&& left_fun) const&& -> either<std::invoke_result_t<Fun, const left_type>, right_type>
+         Fun&& left_fun) const&& -> rebind<std::invoke_result_t<Fun, const left_type>, right_type>
       {
+         using ret = rebind<std::invoke_result_t<Fun, const left_type>, right_type>;
+
          if (is_left())
          {
-            return left(std::invoke(std::forward<Fun>(left_fun), take_left()));
+            return ret(detail::from_invoke, in_place_left, std::forward<Fun>(left_fun),
+                       std::move(m_storage.first()));
          }
 
-         return right(take_right());
+         return ret(in_place_right, std::move(m_storage.second()));
       }
       template <std::invocable<left_type> Fun>
       constexpr auto
-      transform_left(Fun&& left_fun) && -> either<std::invoke_result_t<Fun, left_type>, right_type>
+      transform_left(Fun&& left_fun) && -> rebind<std::invoke_result_t<Fun, left_type>, right_type>
       {
+         using ret = rebind<std::invoke_result_t<Fun, left_type>, right_type>;
+
          if (is_left())
          {
-            return left(std::invoke(std::forward<Fun>(left_fun), take_left()));
+            return ret(detail::from_invoke, in_place_left, std::forward<Fun>(left_fun),
+                       std::move(m_storage.first()));
          }
 
-         return right(take_right());
+         return ret(in_place_right, std::move(m_storage.second()));
+      }
+      /**
+       * @brief Transform the left value without consuming the either.
+       *
+       * The left value is passed by reference, only the result of `left_fun` and a copy of the
+       * right value, if any, are stored in the returned either.
+       */
+      template <std::invocable<left_type&> Fun>
+         requires std::copy_constructible<right_type>
+      constexpr auto transform_left(Fun&& left_fun) &
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, left_type&>>, right_type>
+      {
+         using ret = rebind<std::remove_cvref_t<std::invoke_result_t<Fun, left_type&>>, right_type>;
+
+         if (is_left())
+         {
+            return ret(detail::from_invoke, in_place_left, std::forward<Fun>(left_fun),
+                       m_storage.first());
+         }
+
+         return ret(in_place_right, m_storage.second());
+      }
+      template <std::invocable<const left_type&> Fun>
+         requires std::copy_constructible<right_type>
+      constexpr auto transform_left(Fun&& left_fun) const&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const left_type&>>, right_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const left_type&>>, right_type>;
+
+         if (is_left())
+         {
+            return ret(detail::from_invoke, in_place_left, std::forward<Fun>(left_fun),
+                       m_storage.first());
+         }
+
+         return ret(in_place_right, m_storage.second());
       }
 
       template <std::invocable<right_type> Fun>
       constexpr auto transform_right(
-         Fun&& right_fun) const&& -> either<left_type, std::invoke_result_t<Fun, const right_type>>
+         Fun&& right_fun) const&& -> rebind<left_type, std::invoke_result_t<Fun, const right_type>>
       {
+         using ret = rebind<left_type, std::invoke_result_t<Fun, const right_type>>;
+
          if (is_right())
          {
-            return right(std::invoke(std::forward<Fun>(right_fun), take_right()));
+            return ret(detail::from_invoke, in_place_right, std::forward<Fun>(right_fun),
+                       std::move(m_storage.second()));
          }
 
-         return left(take_left());
+         return ret(in_place_left, std::move(m_storage.first()));
       }
       template <std::invocable<right_type> Fun>
       constexpr auto transform_right(
-         Fun&& right_fun) && -> either<left_type, std::invoke_result_t<Fun, right_type>>
+         Fun&& right_fun) && -> rebind<left_type, std::invoke_result_t<Fun, right_type>>
       {
+         using ret = rebind<left_type, std::invoke_result_t<Fun, right_type>>;
+
          if (is_right())
          {
-            return right(std::invoke(std::forward<Fun>(right_fun), take_right()));
+            return ret(detail::from_invoke, in_place_right, std::forward<Fun>(right_fun),
+                       std::move(m_storage.second()));
          }
 
-         return left(take_left());
+         return ret(in_place_left, std::move(m_storage.first()));
+      }
+      /**
+       * @brief Transform the right value without consuming the either.
+       *
+       * The right value is passed by reference, only the result of `right_fun` and a copy of the
+       * left value, if any, are stored in the returned either.
+       */
+      template <std::invocable<right_type&> Fun>
+         requires std::copy_constructible<left_type>
+      constexpr auto transform_right(Fun&& right_fun) &
+         -> rebind<left_type, std::remove_cvref_t<std::invoke_result_t<Fun, right_type&>>>
+      {
+         using ret =
+            rebind<left_type, std::remove_cvref_t<std::invoke_result_t<Fun, right_type&>>>;
+
+         if (is_right())
+         {
+            return ret(detail::from_invoke, in_place_right, std::forward<Fun>(right_fun),
+                       m_storage.second());
+         }
+
+         return ret(in_place_left, m_storage.first());
+      }
+      template <std::invocable<const right_type&> Fun>
+         requires std::copy_constructible<left_type>
+      constexpr auto transform_right(Fun&& right_fun) const&
+         -> rebind<left_type, std::remove_cvref_t<std::invoke_result_t<Fun, const right_type&>>>
+      {
+         using ret =
+            rebind<left_type, std::remove_cvref_t<std::invoke_result_t<Fun, const right_type&>>>;
+
+         if (is_right())
+         {
+            return ret(detail::from_invoke, in_place_right, std::forward<Fun>(right_fun),
+                       m_storage.second());
+         }
+
+         return ret(in_place_left, m_storage.first());
       }
 
       template <detail::ensure_left_either<left_type, right_type> Fun>
@@ -354,20 +491,43 @@ namespace reglisse
       {
          if (is_left())
          {
-            return std::invoke(std::forward<Fun>(left_fun), take_left());
+            return std::invoke(std::forward<Fun>(left_fun), left_type(m_storage.first()));
          }
 
-         return right(take_right());
+         return right(right_type(m_storage.second()));
       }
-      template <std::invocable<left_type> Fun>
+      template <detail::ensure_left_either<left_type, right_type> Fun>
       constexpr auto flat_transform_left(Fun&& left_fun) && -> std::invoke_result_t<Fun, left_type>
       {
          if (is_left())
          {
-            return std::invoke(std::forward<Fun>(left_fun), take_left());
+            return std::invoke(std::forward<Fun>(left_fun), std::move(m_storage.first()));
+         }
+
+         return right(std::move(m_storage.second()));
+      }
+      template <detail::ensure_left_either<left_type&, right_type> Fun>
+         requires std::copy_constructible<right_type>
+      constexpr auto flat_transform_left(Fun&& left_fun) & -> std::invoke_result_t<Fun, left_type&>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<Fun>(left_fun), m_storage.first());
+         }
+
+         return right(right_type(m_storage.second()));
+      }
+      template <detail::ensure_left_either<const left_type&, right_type> Fun>
+         requires std::copy_constructible<right_type>
+      constexpr auto flat_transform_left(Fun&& left_fun) const&
+         -> std::invoke_result_t<Fun, const left_type&>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<Fun>(left_fun), m_storage.first());
          }
 
-         return right(take_right());
+         return right(right_type(m_storage.second()));
       }
 
       template <detail::ensure_right_either<left_type, right_type> Fun>
@@ -376,10 +536,10 @@ namespace reglisse
       {
          if (is_right())
          {
-            return std::invoke(std::forward<Fun>(right_fun), take_right());
+            return std::invoke(std::forward<Fun>(right_fun), right_type(m_storage.second()));
          }
 
-         return left(take_left());
+         return left(left_type(m_storage.first()));
       }
       template <detail::ensure_right_either<left_type, right_type> Fun>
       constexpr auto
@@ -387,21 +547,244 @@ namespace reglisse
       {
          if (is_right())
          {
-            return std::invoke(std::forward<Fun>(right_fun), take_right());
+            return std::invoke(std::forward<Fun>(right_fun), std::move(m_storage.second()));
          }
 
-         return left(take_left());
+         return left(std::move(m_storage.first()));
       }
+      template <detail::ensure_right_either<left_type, right_type&> Fun>
+         requires std::copy_constructible<left_type>
+      constexpr auto flat_transform_right(Fun&& right_fun) &
+         -> std::invoke_result_t<Fun, right_type&>
+      {
+         if (is_right())
+         {
+            return std::invoke(std::forward<Fun>(right_fun), m_storage.second());
+         }
 
-   private:
-      bool m_is_left = true;
+         return left(left_type(m_storage.first()));
+      }
+      template <detail::ensure_right_either<left_type, const right_type&> Fun>
+         requires std::copy_constructible<left_type>
+      constexpr auto flat_transform_right(Fun&& right_fun) const&
+         -> std::invoke_result_t<Fun, const right_type&>
+      {
+         if (is_right())
+         {
+            return std::invoke(std::forward<Fun>(right_fun), m_storage.second());
+         }
 
-      union
+         return left(left_type(m_storage.first()));
+      }
+
+      /**
+       * @brief Call `fun` with the value held on either side.
+       *
+       * The side of the either is only tested once and the value is passed by
+       * reference, following the value category of the either. Use the two callables overload
+       * when `left_type` and `right_type` are the same.
+       *
+       * @param fun A callable, usually an `overloaded` set, invocable with both the left and the
+       * right values.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, left_type&> and std::invocable<Fun, right_type&> and
+                  not std::same_as<left_type, right_type>)
+      constexpr auto match(Fun&& fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, left_type&>,
+                               std::invoke_result_t<Fun, right_type&>>
       {
-         left_type m_left;
-         right_type m_right;
-      };
+         if (is_left())
+         {
+            return std::invoke(std::forward<Fun>(fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, const left_type&> and
+                  std::invocable<Fun, const right_type&> and
+                  not std::same_as<left_type, right_type>)
+      constexpr auto match(Fun&& fun) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const left_type&>,
+                               std::invoke_result_t<Fun, const right_type&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<Fun>(fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, left_type&&> and std::invocable<Fun, right_type&&> and
+                  not std::same_as<left_type, right_type>)
+      constexpr auto match(Fun&& fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, left_type&&>,
+                               std::invoke_result_t<Fun, right_type&&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<Fun>(fun), std::move(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(fun), std::move(m_storage.second()));
+      }
+
+      /**
+       * @brief Call `left_fun` with the left value, or `right_fun` with the right value.
+       *
+       * The side of the either is only tested once and the value is passed by
+       * reference, following the value category of the either.
+       */
+      template <std::invocable<left_type&> LeftFun, std::invocable<right_type&> RightFun>
+      constexpr auto match(LeftFun&& left_fun, RightFun&& right_fun) &
+         -> std::common_type_t<std::invoke_result_t<LeftFun, left_type&>,
+                               std::invoke_result_t<RightFun, right_type&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<LeftFun>(left_fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<RightFun>(right_fun), m_storage.second());
+      }
+      template <std::invocable<const left_type&> LeftFun,
+                std::invocable<const right_type&> RightFun>
+      constexpr auto match(LeftFun&& left_fun, RightFun&& right_fun) const&
+         -> std::common_type_t<std::invoke_result_t<LeftFun, const left_type&>,
+                               std::invoke_result_t<RightFun, const right_type&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<LeftFun>(left_fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<RightFun>(right_fun), m_storage.second());
+      }
+      template <std::invocable<left_type&&> LeftFun, std::invocable<right_type&&> RightFun>
+      constexpr auto match(LeftFun&& left_fun, RightFun&& right_fun) &&
+         -> std::common_type_t<std::invoke_result_t<LeftFun, left_type&&>,
+                               std::invoke_result_t<RightFun, right_type&&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<LeftFun>(left_fun), std::move(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<RightFun>(right_fun), std::move(m_storage.second()));
+      }
+
+   private:
+      /**
+       * @brief Create an either holding the left value returned by `fun` when called with `args`.
+       *
+       * The returned value is constructed directly in the storage of the either.
+       */
+      template <class Fun, class... Args>
+      constexpr either(detail::from_invoke_t, in_place_left_t, Fun&& fun, Args&&... args) :
+         m_storage(detail::from_invoke, std::in_place_index<0>, std::forward<Fun>(fun),
+                   std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create an either holding the right value returned by `fun` when called with
+       * `args`.
+       *
+       * The returned value is constructed directly in the storage of the either.
+       */
+      template <class Fun, class... Args>
+      constexpr either(detail::from_invoke_t, in_place_right_t, Fun&& fun, Args&&... args) :
+         m_storage(detail::from_invoke, std::in_place_index<1>, std::forward<Fun>(fun),
+                   std::forward<Args>(args)...)
+      {}
+
+   private:
+      detail::binary_storage<left_type, right_type> m_storage;
    };
+
+   /**
+    * @brief An either is trivially relocatable if both its left and right types are.
+    */
+   template <class L, class R, class Check>
+   struct is_trivially_relocatable<either<L, R, Check>> :
+      std::bool_constant<is_trivially_relocatable_v<L> and is_trivially_relocatable_v<R>>
+   {
+   };
+
+   /**
+    * @brief Create an either holding a left value constructed in place from `args`.
+    *
+    * @param args The arguments forwarded to the constructor of the left value.
+    *
+    * @tparam L The left type of the either.
+    * @tparam R The right type of the either.
+    * @tparam Check The check policy of the either.
+    */
+   template <class L, class R, check_policy Check = default_check, class... Args>
+      requires std::constructible_from<L, Args...>
+   constexpr auto make_left(Args&&... args) -> either<L, R, Check>
+   {
+      return either<L, R, Check>(in_place_left, std::forward<Args>(args)...);
+   }
+
+   /**
+    * @brief Create an either holding a right value constructed in place from `args`.
+    *
+    * @param args The arguments forwarded to the constructor of the right value.
+    *
+    * @tparam L The left type of the either.
+    * @tparam R The right type of the either.
+    * @tparam Check The check policy of the either.
+    */
+   template <class L, class R, check_policy Check = default_check, class... Args>
+      requires std::constructible_from<R, Args...>
+   constexpr auto make_right(Args&&... args) -> either<L, R, Check>
+   {
+      return either<L, R, Check>(in_place_right, std::forward<Args>(args)...);
+   }
+
+   /**
+    * @brief Two eithers are equal if they hold equal values on the same side.
+    */
+   template <class FirstLeft, class FirstRight, class FirstCheck,
+             std::equality_comparable_with<FirstLeft> SecondLeft,
+             std::equality_comparable_with<FirstRight> SecondRight, class SecondCheck>
+   constexpr auto operator==(const either<FirstLeft, FirstRight, FirstCheck>& lhs,
+                             const either<SecondLeft, SecondRight, SecondCheck>& rhs) -> bool
+   {
+      if (lhs.is_left() != rhs.is_left())
+      {
+         return false;
+      }
+
+      if (lhs.is_left())
+      {
+         return lhs.borrow_left() == rhs.borrow_left();
+      }
+
+      return lhs.borrow_right() == rhs.borrow_right();
+   }
+
+   template <class L, class R, class Check, std::equality_comparable_with<L> Other>
+   constexpr auto operator==(const either<L, R, Check>& e, const left<Other>& value) -> bool
+   {
+      return e.is_left() and e.borrow_left() == value.value();
+   }
+
+   template <class L, class R, class Check, std::equality_comparable_with<R> Other>
+   constexpr auto operator==(const either<L, R, Check>& e, const right<Other>& value) -> bool
+   {
+      return e.is_right() and e.borrow_right() == value.value();
+   }
 } // namespace reglisse
 
+namespace std // NOLINT
+{
+   template <class L, class R, class Check>
+   constexpr void swap(reglisse::either<L, R, Check>& lhs, reglisse::either<L, R, Check>& rhs)
+   {
+      lhs.swap(rhs);
+   }
+} // namespace std
+
 #endif // LIBREGLISSE_EITHER_HPP
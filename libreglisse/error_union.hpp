@@ -0,0 +1,493 @@
+/**
+ * @file error_union.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the error_union type used to widen the error type of results.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ERROR_UNION_HPP
+#define LIBREGLISSE_ERROR_UNION_HPP
+
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/dispatch.hpp>
+#include <libreglisse/detail/variadic_union.hpp>
+#include <libreglisse/detail/widen_error.hpp>
+#include <libreglisse/relocate.hpp>
+
+#include <concepts>
+#include <type_traits>
+
+namespace reglisse::detail
+{
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_error_union_access(bool check)
+   {
+      Check::check(check, "error_union holds another error type");
+   }
+
+   template <check_policy Check = default_check>
+   constexpr void handle_valueless_error_union_access(bool check)
+   {
+      Check::check(check, "error_union lost its error to a throwing move");
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief A compact tagged union of error types.
+    *
+    * Used as the error type of a result when `and_then` chains continuations that may fail with
+    * different error types. The errors are stored inline, the active one is tracked using the
+    * smallest possible tag.
+    *
+    * @tparam Check The policy called when an error is accessed as the wrong type.
+    * @tparam Errors The error types that may be held.
+    */
+   template <check_policy Check, std::destructible... Errors>
+      requires(sizeof...(Errors) > 0 and not(std::is_reference_v<Errors> or ...))
+   class basic_error_union
+   {
+      template <check_policy OtherCheck, std::destructible... Others>
+         requires(sizeof...(Others) > 0 and not(std::is_reference_v<Others> or ...))
+      friend class basic_error_union;
+
+      static constexpr std::size_t error_count = sizeof...(Errors);
+
+      using index_type = detail::smallest_index_t<error_count>;
+
+      static constexpr bool may_be_valueless =
+         not(std::is_nothrow_move_constructible_v<Errors> and ...);
+      static constexpr auto valueless_index = static_cast<index_type>(error_count);
+
+   public:
+      using check_type = Check;
+
+   public:
+      /**
+       * @brief Create an error_union holding `error`.
+       */
+      template <class Error>
+         requires detail::is_one_of<std::remove_cvref_t<Error>, Errors...>
+      constexpr basic_error_union(Error&& error) :
+         m_index(detail::index_of_v<std::remove_cvref_t<Error>, Errors...>),
+         m_storage(std::in_place_index<detail::index_of_v<std::remove_cvref_t<Error>, Errors...>>,
+                   std::forward<Error>(error))
+      {}
+      /**
+       * @brief Widen an error_union holding a subset of `Errors`.
+       */
+      template <class OtherCheck, class... Others>
+         requires(not std::same_as<basic_error_union<OtherCheck, Others...>, basic_error_union> and
+                  (detail::is_one_of<Others, Errors...> and ...))
+      constexpr basic_error_union(const basic_error_union<OtherCheck, Others...>& other)
+      {
+         if (other.valueless_by_exception())
+         {
+            m_index = valueless_index;
+
+            return;
+         }
+
+         other.visit([this]<class Error>(const Error& error) {
+            construct<detail::index_of_v<Error, Errors...>>(error);
+         });
+      }
+      /**
+       * @brief Widen an error_union holding a subset of `Errors`.
+       */
+      template <class OtherCheck, class... Others>
+         requires(not std::same_as<basic_error_union<OtherCheck, Others...>, basic_error_union> and
+                  (detail::is_one_of<Others, Errors...> and ...))
+      constexpr basic_error_union(basic_error_union<OtherCheck, Others...>&& other)
+      {
+         if (other.valueless_by_exception())
+         {
+            m_index = valueless_index;
+
+            return;
+         }
+
+         std::move(other).visit([this]<class Error>(Error&& error) {
+            construct<detail::index_of_v<std::remove_cvref_t<Error>, Errors...>>(
+               std::forward<Error>(error));
+         });
+      }
+      constexpr basic_error_union(const basic_error_union& other) requires(
+         std::copy_constructible<Errors> and ...)
+      {
+         if (other.valueless_by_exception())
+         {
+            m_index = valueless_index;
+
+            return;
+         }
+
+         detail::dispatch<void, error_count>(other.m_index, [&]<std::size_t I>(
+                                                               detail::index_constant<I>) {
+            construct<I>(detail::get<I>(other.m_storage));
+         });
+      }
+      constexpr basic_error_union(basic_error_union&& other) noexcept(
+         (std::is_nothrow_move_constructible_v<Errors> and ...))
+         requires(std::move_constructible<Errors> and ...)
+      {
+         if (other.valueless_by_exception())
+         {
+            m_index = valueless_index;
+
+            return;
+         }
+
+         detail::dispatch<void, error_count>(other.m_index, [&]<std::size_t I>(
+                                                               detail::index_constant<I>) {
+            construct<I>(detail::get<I>(std::move(other.m_storage)));
+         });
+      }
+      constexpr ~basic_error_union() { destroy(); }
+
+      constexpr auto operator=(const basic_error_union& rhs)
+         -> basic_error_union& requires(std::copy_constructible<Errors> and ...)
+      {
+         if (this != &rhs)
+         {
+            if (rhs.valueless_by_exception())
+            {
+               destroy();
+               m_index = valueless_index;
+
+               return *this;
+            }
+
+            detail::dispatch<void, error_count>(rhs.m_index, [&]<std::size_t I>(
+                                                                detail::index_constant<I>) {
+               replace<I>(detail::get<I>(rhs.m_storage));
+            });
+         }
+
+         return *this;
+      }
+      constexpr auto operator=(basic_error_union&& rhs) noexcept(
+         (std::is_nothrow_move_constructible_v<Errors> and ...))
+         -> basic_error_union& requires(std::move_constructible<Errors> and ...)
+      {
+         if (this != &rhs)
+         {
+            if (rhs.valueless_by_exception())
+            {
+               destroy();
+               m_index = valueless_index;
+
+               return *this;
+            }
+
+            detail::dispatch<void, error_count>(rhs.m_index, [&]<std::size_t I>(
+                                                                detail::index_constant<I>) {
+               replace<I>(detail::get<I>(std::move(rhs.m_storage)));
+            });
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief The position of the held error in `Errors`, or the number of error types if the
+       * error_union is valueless.
+       */
+      [[nodiscard]] constexpr auto index() const noexcept -> std::size_t { return m_index; }
+
+      /**
+       * @brief Check if an assignment lost the held error.
+       *
+       * Assignments keep the held error when building the new one throws. Only when an error type
+       * may throw on move, and its move into the storage does, is the error_union left without an
+       * error. It may then only be assigned to, copied, compared or destroyed.
+       */
+      [[nodiscard]] constexpr auto valueless_by_exception() const noexcept -> bool
+      {
+         if constexpr (may_be_valueless)
+         {
+            return m_index == valueless_index;
+         }
+         else
+         {
+            return false;
+         }
+      }
+
+      /**
+       * @brief Check if the held error is of type `Error`.
+       */
+      template <class Error>
+         requires detail::is_one_of<Error, Errors...>
+      [[nodiscard]] constexpr auto holds() const noexcept -> bool
+      {
+         return m_index == detail::index_of_v<Error, Errors...>;
+      }
+
+      template <class Error>
+         requires detail::is_one_of<Error, Errors...>
+      constexpr auto borrow() const& -> const Error&
+      {
+         detail::handle_invalid_error_union_access<check_type>(holds<Error>());
+
+         return detail::get<detail::index_of_v<Error, Errors...>>(m_storage);
+      }
+      template <class Error>
+         requires detail::is_one_of<Error, Errors...>
+      constexpr auto borrow() & -> Error&
+      {
+         detail::handle_invalid_error_union_access<check_type>(holds<Error>());
+
+         return detail::get<detail::index_of_v<Error, Errors...>>(m_storage);
+      }
+      template <class Error>
+         requires detail::is_one_of<Error, Errors...>
+      constexpr auto take() && -> Error
+      {
+         detail::handle_invalid_error_union_access<check_type>(holds<Error>());
+
+         return detail::get<detail::index_of_v<Error, Errors...>>(std::move(m_storage));
+      }
+
+      /**
+       * @brief Call `fun` with the held error.
+       *
+       * @param fun A callable, usually an `overloaded` set, invocable with every error type.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, Errors&> and ...)
+      constexpr auto visit(Fun&& fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, Errors&>...>
+      {
+         using ret = std::common_type_t<std::invoke_result_t<Fun, Errors&>...>;
+
+         detail::handle_valueless_error_union_access<check_type>(not valueless_by_exception());
+
+         return detail::dispatch<ret, error_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) -> ret {
+               return std::invoke(std::forward<Fun>(fun), detail::get<I>(m_storage));
+            });
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, const Errors&> and ...)
+      constexpr auto visit(Fun&& fun) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const Errors&>...>
+      {
+         using ret = std::common_type_t<std::invoke_result_t<Fun, const Errors&>...>;
+
+         detail::handle_valueless_error_union_access<check_type>(not valueless_by_exception());
+
+         return detail::dispatch<ret, error_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) -> ret {
+               return std::invoke(std::forward<Fun>(fun), detail::get<I>(m_storage));
+            });
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, Errors&&> and ...)
+      constexpr auto visit(Fun&& fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, Errors&&>...>
+      {
+         using ret = std::common_type_t<std::invoke_result_t<Fun, Errors&&>...>;
+
+         detail::handle_valueless_error_union_access<check_type>(not valueless_by_exception());
+
+         return detail::dispatch<ret, error_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) -> ret {
+               return std::invoke(std::forward<Fun>(fun), detail::get<I>(std::move(m_storage)));
+            });
+      }
+
+      constexpr auto operator==(const basic_error_union& rhs) const
+         -> bool requires(std::equality_comparable<Errors> and ...)
+      {
+         if (m_index != rhs.m_index)
+         {
+            return false;
+         }
+
+         if (valueless_by_exception())
+         {
+            return true;
+         }
+
+         return detail::dispatch<bool, error_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+               return detail::get<I>(m_storage) == detail::get<I>(rhs.m_storage);
+            });
+      }
+
+      template <class Error>
+         requires(detail::is_one_of<Error, Errors...> and std::equality_comparable<Error>)
+      constexpr auto operator==(const Error& rhs) const -> bool
+      {
+         return holds<Error>() && borrow<Error>() == rhs;
+      }
+
+   private:
+      template <std::size_t I, class... Args>
+      constexpr void construct(Args&&... args)
+      {
+         std::construct_at(&m_storage, std::in_place_index<I>, std::forward<Args>(args)...);
+         m_index = static_cast<index_type>(I);
+      }
+
+      /**
+       * @brief Destroy the held error and construct the `I`th one from `args`.
+       *
+       * A constructor that may throw builds the new error in a temporary first, so that the held
+       * one is only destroyed once the temporary exists. If moving the temporary in may throw as
+       * well, the error_union is marked valueless in between.
+       */
+      template <std::size_t I, class... Args>
+      constexpr void replace(Args&&... args)
+      {
+         using error_type = detail::nth_type_t<I, Errors...>;
+
+         if constexpr (std::is_nothrow_constructible_v<error_type, Args...>)
+         {
+            destroy();
+            construct<I>(std::forward<Args>(args)...);
+         }
+         else
+         {
+            error_type error(std::forward<Args>(args)...);
+
+            destroy();
+
+            if constexpr (not std::is_nothrow_move_constructible_v<error_type>)
+            {
+               m_index = valueless_index;
+            }
+
+            construct<I>(std::move(error));
+         }
+      }
+
+      constexpr void destroy()
+      {
+         if (valueless_by_exception())
+         {
+            return;
+         }
+
+         detail::dispatch<void, error_count>(m_index, [&]<std::size_t I>(
+                                                         detail::index_constant<I>) {
+            std::destroy_at(&detail::get<I>(m_storage));
+         });
+      }
+
+   private:
+      index_type m_index{};
+
+      detail::variadic_union<Errors...> m_storage{};
+   };
+
+   /**
+    * @brief A basic_error_union using the default check policy.
+    */
+   template <class... Errors>
+   using error_union = basic_error_union<default_check, Errors...>;
+
+   /**
+    * @brief An error_union is trivially relocatable if all of its errors are.
+    */
+   template <class Check, class... Errors>
+   struct is_trivially_relocatable<basic_error_union<Check, Errors...>> :
+      std::bool_constant<(is_trivially_relocatable_v<Errors> and ...)>
+   {
+   };
+} // namespace reglisse
+
+namespace reglisse::detail
+{
+   template <class... Ts>
+   struct type_list
+   {
+   };
+
+   template <class List, class... Ts>
+   struct unique_append;
+
+   template <class... Ls>
+   struct unique_append<type_list<Ls...>>
+   {
+      using type = type_list<Ls...>;
+   };
+
+   template <class... Ls, class T, class... Ts>
+   struct unique_append<type_list<Ls...>, T, Ts...> :
+      unique_append<std::conditional_t<is_one_of<T, Ls...>, type_list<Ls...>, type_list<Ls..., T>>,
+                    Ts...>
+   {
+   };
+
+   /**
+    * @brief The error types held by `Error`, along with the check policy of a widened union.
+    */
+   template <class Error>
+   struct error_alternatives
+   {
+      using type = type_list<Error>;
+      using check_type = void;
+   };
+
+   template <class Check, class... Errors>
+   struct error_alternatives<basic_error_union<Check, Errors...>>
+   {
+      using type = type_list<Errors...>;
+      using check_type = Check;
+   };
+
+   /**
+    * @brief The check policy of the union widening `First` and `Second`: the one of the first
+    * error_union among them, `default_check` if neither is an error_union.
+    */
+   template <class First, class Second>
+   using widened_check_t = std::conditional_t<
+      not std::is_void_v<typename error_alternatives<First>::check_type>,
+      typename error_alternatives<First>::check_type,
+      std::conditional_t<not std::is_void_v<typename error_alternatives<Second>::check_type>,
+                         typename error_alternatives<Second>::check_type, default_check>>;
+
+   template <class Check, class First, class Second>
+   struct widen_error;
+
+   template <class Check, class... Firsts, class... Seconds>
+   struct widen_error<Check, type_list<Firsts...>, type_list<Seconds...>>
+   {
+      template <class List>
+      struct to_union;
+
+      template <class... Errors>
+      struct to_union<type_list<Errors...>>
+      {
+         using type = basic_error_union<Check, Errors...>;
+      };
+
+      using type =
+         typename to_union<typename unique_append<type_list<>, Firsts..., Seconds...>::type>::type;
+   };
+
+   template <class Check, class... Errors>
+   inline constexpr bool is_error_union<basic_error_union<Check, Errors...>> = true;
+
+   template <class First, class Second>
+   using widened_union_t = typename widen_error<widened_check_t<First, Second>,
+                                                typename error_alternatives<First>::type,
+                                                typename error_alternatives<Second>::type>::type;
+
+   /**
+    * @brief `First` is kept as is if it already covers `Second`, otherwise an error_union of all
+    * the distinct error types is used.
+    */
+   template <class First, class Second>
+   struct widened_error<First, Second, std::void_t<typename error_alternatives<First>::type>>
+   {
+      using type = std::conditional_t<std::same_as<widened_union_t<First, Second>, First>, First,
+                                      widened_union_t<First, Second>>;
+   };
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_ERROR_UNION_HPP
@@ -0,0 +1,86 @@
+/**
+ * @file likelihood.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Branch hints telling the compiler which side of a monadic type is expected.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_LIKELIHOOD_HPP
+#define LIBREGLISSE_LIKELIHOOD_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+namespace reglisse
+{
+   /**
+    * @brief Which outcome of a monadic type is expected at run time. Success is a `maybe` holding
+    * a value or a `result` holding a value.
+    */
+   enum struct outcome_likelihood : std::uint8_t
+   {
+      unknown,
+      success_likely,
+      failure_likely
+   };
+
+   template <outcome_likelihood Likelihood>
+   using outcome_constant = std::integral_constant<outcome_likelihood, Likelihood>;
+
+   using success_is_likely = outcome_constant<outcome_likelihood::success_likely>;
+   using failure_is_likely = outcome_constant<outcome_likelihood::failure_likely>;
+
+   /**
+    * @brief The expected outcome of `Monad`, used to lay out the branches of `transform`,
+    * `and_then`, `or_else`, `take_or`, `join` and `match`.
+    *
+    * No hint is given by default. Specialize it for a monadic type before its first use to give
+    * one, for instance:
+    *
+    * @code
+    * template <class Check>
+    * struct reglisse::expected_outcome<reglisse::maybe<cache_entry, Check>> :
+    *    reglisse::failure_is_likely
+    * {};
+    * @endcode
+    *
+    * @tparam Monad A `maybe` or a `result`.
+    */
+   template <class Monad>
+   struct expected_outcome : outcome_constant<outcome_likelihood::unknown>
+   {
+   };
+
+   template <class Monad>
+   inline constexpr outcome_likelihood expected_outcome_v = expected_outcome<Monad>::value;
+} // namespace reglisse
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Return `is_success`, hinting the compiler towards the expected outcome.
+    */
+   template <outcome_likelihood Likelihood>
+   [[nodiscard]] constexpr auto expect_success(bool is_success) noexcept -> bool
+   {
+#if defined(__GNUC__)
+      if constexpr (Likelihood == outcome_likelihood::success_likely)
+      {
+         return __builtin_expect(static_cast<long>(is_success), 1L) != 0L;
+      }
+      else if constexpr (Likelihood == outcome_likelihood::failure_likely)
+      {
+         return __builtin_expect(static_cast<long>(is_success), 0L) != 0L;
+      }
+      else
+      {
+         return is_success;
+      }
+#else
+      return is_success;
+#endif // defined(__GNUC__)
+   }
+} // namespace reglisse::detail
+
+#endif // LIBREGLISSE_LIKELIHOOD_HPP
@@ -0,0 +1,42 @@
+/**
+ * @file match.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Free function used to pattern match on the monadic types.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_MATCH_HPP
+#define LIBREGLISSE_MATCH_HPP
+
+#include <libreglisse/overloaded.hpp>
+
+#include <utility>
+
+namespace reglisse
+{
+   /**
+    * @brief Call the callable matching the current state of `monad`.
+    *
+    * The monad is taken by forwarding reference, lvalues and const lvalues are never copied nor
+    * moved and the callables receive a reference to the held value.
+    *
+    * @code
+    * match(res, overloaded{[](const config& cfg) { ... }, [](const error& err) { ... }});
+    * @endcode
+    *
+    * @param monad The maybe, result or either to match on.
+    * @param funs Either a single overload set, or one callable per possible state.
+    */
+   template <class Monad, class... Funs>
+      requires requires(Monad&& monad, Funs&&... funs)
+      {
+         std::forward<Monad>(monad).match(std::forward<Funs>(funs)...);
+      }
+   constexpr auto match(Monad&& monad, Funs&&... funs) -> decltype(auto)
+   {
+      return std::forward<Monad>(monad).match(std::forward<Funs>(funs)...);
+   }
+} // namespace reglisse
+
+#endif // LIBREGLISSE_MATCH_HPP
@@ -9,36 +9,33 @@
 #ifndef LIBREGLISSE_MAYBE_HPP
 #define LIBREGLISSE_MAYBE_HPP
 
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-#   include <libreglisse/detail/invalid_access_exception.hpp>
-#else
-#   include <cassert>
-#endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/from_invoke.hpp>
+#include <libreglisse/likelihood.hpp>
+#include <libreglisse/relocate.hpp>
 
 #include <compare>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 
 namespace reglisse::detail
 {
-   inline void handle_invalid_maybe_access(bool check)
+   struct c_layout;
+   struct zip_access;
+
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_maybe_access(bool check)
    {
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-      if (!check)
-      {
-         throw invalid_access_exception("no value stored in maybe");
-      }
-#else
-      assert(check && "no value stored in maybe"); // NOLINT
-#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+      Check::check(check, "no value stored in maybe");
    }
 } // namespace reglisse::detail
 
 namespace reglisse
 {
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class some;
 
@@ -59,9 +56,9 @@ namespace reglisse
    /**
     * @brief
     */
-   static inline constexpr auto none = none_t();
+   inline constexpr auto none = none_t();
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class [[nodiscard]] some
    {
@@ -92,13 +89,26 @@ namespace reglisse
     * @brief
     *
     * @tparam T The type being held by the maybe monad.
+    * @tparam Check The policy called when the value is accessed on an empty maybe.
     */
-   template <typename T>
+   template <typename T, check_policy Check = default_check>
       requires(not std::is_reference_v<T>)
    class [[nodiscard]] maybe
    {
+      template <typename U, check_policy OtherCheck>
+         requires(not std::is_reference_v<U>)
+      friend class maybe;
+
+      friend struct detail::c_layout;
+      friend struct detail::zip_access;
+
    public:
       using value_type = T;
+      using check_type = Check;
+
+   private:
+      template <class U>
+      using rebind = maybe<U, check_type>;
 
    public:
       /**
@@ -115,14 +125,45 @@ namespace reglisse
        * @param val
        */
       constexpr maybe(some<T>&& val) : m_is_none(false), m_value(std::move(val.value())) {}
-      constexpr maybe(const maybe& other) : m_is_none(other.is_none())
+      /**
+       * @brief Create a monad holding a value constructed in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr explicit maybe(std::in_place_t, Args&&... args) :
+         m_is_none(false), m_value(std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create a monad from a `std::optional`, moving its value, if any, exactly once.
+       */
+      constexpr maybe(std::optional<value_type>&& other) requires
+         std::move_constructible<value_type> : m_is_none(not other.has_value())
+      {
+         if (other.has_value())
+         {
+            std::construct_at(&m_value, std::move(*other)); // NOLINT
+         }
+      }
+      constexpr maybe(const std::optional<value_type>& other) requires
+         std::copy_constructible<value_type> : m_is_none(not other.has_value())
+      {
+         if (other.has_value())
+         {
+            std::construct_at(&m_value, *other); // NOLINT
+         }
+      }
+      constexpr maybe(const maybe& other) requires std::copy_constructible<value_type> :
+         m_is_none(other.is_none())
       {
          if (other.is_some())
          {
             std::construct_at(&m_value, other.m_value); // NOLINT
          }
       }
-      constexpr maybe(maybe&& other) noexcept : m_is_none(other.is_none())
+      constexpr maybe(maybe&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+         requires std::move_constructible<value_type> : m_is_none(other.is_none())
       {
          if (other.is_some())
          {
@@ -137,64 +178,66 @@ namespace reglisse
          }
       }
 
-      constexpr auto operator=(const maybe& rhs) -> maybe&
+      /**
+       * @brief Replace the held value, if any, with a copy of the value of `rhs`.
+       *
+       * The maybe is empty while the new value is being built, so it stays valid if that throws.
+       */
+      constexpr auto operator=(const maybe& rhs)
+         -> maybe& requires std::copy_constructible<value_type>
       {
          if (this != &rhs)
          {
-            if (is_some())
-            {
-               std::destroy_at(&m_value); // NOLINT
-            }
+            reset();
 
-            m_is_none = rhs.is_none();
-            rhs.m_is_none = false;
-
-            if (is_some())
+            if (rhs.is_some())
             {
-               std::construct_at(&m_value, rhs.borrow()); // NOLINT
+               std::construct_at(&m_value, rhs.m_value); // NOLINT
+               m_is_none = false;
             }
          }
+
+         return *this;
       }
-      constexpr auto operator=(maybe&& rhs) noexcept -> maybe&
+      constexpr auto operator=(maybe&& rhs) noexcept(
+         std::is_nothrow_move_constructible_v<value_type>)
+         -> maybe& requires std::move_constructible<value_type>
       {
          if (this != &rhs)
          {
-            if (is_some())
-            {
-               std::destroy_at(&m_value); // NOLINT
-            }
+            reset();
 
-            m_is_none = rhs.is_none();
-            rhs.m_is_none = false;
-
-            if (is_some())
+            if (rhs.is_some())
             {
-               std::construct_at(&m_value, std::move(rhs.borrow())); // NOLINT
+               std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+               m_is_none = false;
             }
          }
+
+         return *this;
       }
 
       constexpr auto borrow() & -> value_type&
       {
-         detail::handle_invalid_maybe_access(is_some());
+         detail::handle_invalid_maybe_access<check_type>(is_some());
 
          return m_value; // NOLINT
       }
       constexpr auto borrow() const& -> const value_type&
       {
-         detail::handle_invalid_maybe_access(is_some());
+         detail::handle_invalid_maybe_access<check_type>(is_some());
 
          return m_value; // NOLINT
       }
       constexpr auto take() && -> value_type
       {
-         detail::handle_invalid_maybe_access(is_some());
+         detail::handle_invalid_maybe_access<check_type>(is_some());
 
          return std::move(m_value); // NOLINT
       }
       constexpr auto take() const&& -> const value_type
       {
-         detail::handle_invalid_maybe_access(is_some());
+         detail::handle_invalid_maybe_access<check_type>(is_some());
 
          return std::move(m_value); // NOLINT
       }
@@ -202,7 +245,7 @@ namespace reglisse
       template <std::convertible_to<value_type> U>
       constexpr auto take_or(U&& or_val) && -> value_type
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::move(m_value); // NOLINT
          }
@@ -212,7 +255,7 @@ namespace reglisse
       template <std::convertible_to<value_type> U>
       constexpr auto take_or(U&& or_val) const&& -> value_type
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::move(m_value); // NOLINT
          }
@@ -220,6 +263,48 @@ namespace reglisse
          return static_cast<value_type>(std::forward<U>(or_val));
       }
 
+      /**
+       * @brief Move the held value, if any, into a `std::optional`, exactly once.
+       */
+      constexpr auto to_optional() && -> std::optional<value_type>
+      {
+         if (is_some())
+         {
+            return std::optional<value_type>(std::in_place, std::move(m_value)); // NOLINT
+         }
+
+         return std::nullopt;
+      }
+      constexpr auto to_optional() const& -> std::optional<value_type>
+         requires std::copy_constructible<value_type>
+      {
+         if (is_some())
+         {
+            return std::optional<value_type>(std::in_place, m_value); // NOLINT
+         }
+
+         return std::nullopt;
+      }
+
+      /**
+       * @brief Destroy the held value, if any, and construct a new one in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the value.
+       *
+       * @return A reference to the newly constructed value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr auto emplace(Args&&... args) -> value_type&
+      {
+         reset();
+
+         std::construct_at(&m_value, std::forward<Args>(args)...); // NOLINT
+         m_is_none = false;
+
+         return m_value; // NOLINT
+      }
+
       constexpr void reset()
       {
          if (is_some())
@@ -237,19 +322,17 @@ namespace reglisse
          }
          else if (is_some() && other.is_none())
          {
+            std::construct_at(&other.m_value, std::move(m_value)); // NOLINT
             other.m_is_none = false;
-            other.borrow() = borrow();
 
-            m_is_none = true;
-            std::destroy_at(&m_value); // NOLINT
+            reset();
          }
          else if (is_none() && other.is_some())
          {
+            std::construct_at(&m_value, std::move(other.m_value)); // NOLINT
             m_is_none = false;
-            borrow() = other.borrow();
 
-            other.m_is_none = true;
-            std::destroy_at(&other.m_value); // NOLINT
+            other.reset();
          }
       }
 
@@ -259,21 +342,53 @@ namespace reglisse
 
       template <std::invocable<value_type> Fun>
       constexpr auto
-      transform(Fun&& some_fun) const&& -> maybe<std::invoke_result_t<Fun, value_type&&>>
+      transform(Fun&& some_fun) const&& -> rebind<std::invoke_result_t<Fun, value_type&&>>
       {
-         if (is_some())
+         if (expect_some())
          {
-            return some(std::invoke(std::forward<Fun>(some_fun), std::move(m_value))); // NOLINT
+            return rebind<std::invoke_result_t<Fun, value_type&&>>(
+               detail::from_invoke, std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
          }
 
          return none;
       }
       template <std::invocable<value_type> Fun>
-      constexpr auto transform(Fun&& some_fun) && -> maybe<std::invoke_result_t<Fun, value_type&&>>
+      constexpr auto transform(Fun&& some_fun) && -> rebind<std::invoke_result_t<Fun, value_type&&>>
       {
-         if (is_some())
+         if (expect_some())
          {
-            return some(std::invoke(std::forward<Fun>(some_fun), std::move(m_value))); // NOLINT
+            return rebind<std::invoke_result_t<Fun, value_type&&>>(
+               detail::from_invoke, std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
+         }
+
+         return none;
+      }
+      /**
+       * @brief Transform the held value without consuming the maybe.
+       *
+       * The value is passed by reference, only the result of `some_fun` is stored in the returned
+       * maybe. This allows reading a member through `transform` without copying the whole value.
+       */
+      template <std::invocable<value_type&> Fun>
+      constexpr auto transform(Fun&& some_fun) &
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>>
+      {
+         if (expect_some())
+         {
+            return rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>>(
+               detail::from_invoke, std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return none;
+      }
+      template <std::invocable<const value_type&> Fun>
+      constexpr auto transform(Fun&& some_fun) const&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>>
+      {
+         if (expect_some())
+         {
+            return rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>>(
+               detail::from_invoke, std::forward<Fun>(some_fun), m_value); // NOLINT
          }
 
          return none;
@@ -283,7 +398,7 @@ namespace reglisse
       constexpr auto transform_or(Fun&& some_fun, Other&& other)
          const&& -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>, Other>
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
          }
@@ -295,18 +410,40 @@ namespace reglisse
          Fun&& some_fun,
          Other&& other) && -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>, Other>
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
          }
 
          return std::forward<Other>(other);
       }
+      template <std::invocable<value_type&> Fun, class Other>
+      constexpr auto transform_or(Fun&& some_fun, Other&& other) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>, Other>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return std::forward<Other>(other);
+      }
+      template <std::invocable<const value_type&> Fun, class Other>
+      constexpr auto transform_or(Fun&& some_fun, Other&& other) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>, Other>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return std::forward<Other>(other);
+      }
 
       template <std::invocable<value_type> Fun>
       constexpr auto and_then(Fun&& some_fun) const&& -> std::invoke_result_t<Fun, value_type>
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
          }
@@ -316,18 +453,38 @@ namespace reglisse
       template <std::invocable<value_type> Fun>
       constexpr auto and_then(Fun&& some_fun) && -> std::invoke_result_t<Fun, value_type>
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
          }
 
          return none;
       }
+      template <std::invocable<value_type&> Fun>
+      constexpr auto and_then(Fun&& some_fun) & -> std::invoke_result_t<Fun, value_type&>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return none;
+      }
+      template <std::invocable<const value_type&> Fun>
+      constexpr auto and_then(Fun&& some_fun) const& -> std::invoke_result_t<Fun, const value_type&>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return none;
+      }
 
       template <std::invocable Fun>
-      constexpr auto or_else(Fun&& none_fun) const&& -> maybe<value_type>
+      constexpr auto or_else(Fun&& none_fun) const&& -> maybe
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::move(*this);
          }
@@ -335,15 +492,26 @@ namespace reglisse
          return std::invoke(std::forward<Fun>(none_fun));
       }
       template <std::invocable Fun>
-      constexpr auto or_else(Fun&& none_fun) && -> maybe<value_type>
+      constexpr auto or_else(Fun&& none_fun) && -> maybe
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::move(*this);
          }
 
          return std::invoke(std::forward<Fun>(none_fun));
       }
+      template <std::invocable Fun>
+      constexpr auto or_else(Fun&& none_fun) const& -> maybe
+         requires std::copy_constructible<value_type>
+      {
+         if (expect_some())
+         {
+            return *this;
+         }
+
+         return std::invoke(std::forward<Fun>(none_fun));
+      }
 
       template <std::invocable<value_type> Fun, std::invocable Def>
          requires std::convertible_to<std::invoke_result_t<Fun, value_type&&>,
@@ -351,7 +519,7 @@ namespace reglisse
       constexpr auto transform_or_else(Fun&& some_fun,
                                        Def&& none_fun) const&& -> std::invoke_result_t<Def>
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::invoke(std::forward<Fun>(some_fun), std::move(borrow()));
          }
@@ -364,13 +532,147 @@ namespace reglisse
       constexpr auto transform_or_else(Fun&& some_fun,
                                        Def&& none_fun) && -> std::invoke_result_t<Def>
       {
-         if (is_some())
+         if (expect_some())
          {
             return std::invoke(std::forward<Fun>(some_fun), std::move(borrow()));
          }
 
          return std::invoke(std::forward<Def>(none_fun));
       }
+      template <std::invocable<value_type&> Fun, std::invocable Def>
+         requires std::convertible_to<std::invoke_result_t<Fun, value_type&>,
+                                      std::invoke_result_t<Def>>
+      constexpr auto transform_or_else(Fun&& some_fun,
+                                       Def&& none_fun) & -> std::invoke_result_t<Def>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<const value_type&> Fun, std::invocable Def>
+         requires std::convertible_to<std::invoke_result_t<Fun, const value_type&>,
+                                      std::invoke_result_t<Def>>
+      constexpr auto transform_or_else(Fun&& some_fun,
+                                       Def&& none_fun) const& -> std::invoke_result_t<Def>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+      /**
+       * @brief Call `fun` with the held value, or with `none` if the maybe is empty.
+       *
+       * The state of the maybe is only tested once and the value is passed by reference,
+       * following the value category of the maybe.
+       *
+       * @param fun A callable, usually an `overloaded` set, invocable with the value and `none`.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&> and std::invocable<Fun, none_t>)
+      constexpr auto match(Fun&& fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, const value_type&> and std::invocable<Fun, none_t>)
+      constexpr auto match(Fun&& fun) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&&> and std::invocable<Fun, none_t>)
+      constexpr auto match(Fun&& fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), std::move(m_value)); // NOLINT
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+
+      /**
+       * @brief Call `some_fun` with the held value, or `none_fun` if the maybe is empty.
+       *
+       * The state of the maybe is only tested once and the value is passed by reference,
+       * following the value category of the maybe.
+       */
+      template <std::invocable<value_type&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<const value_type&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) const& -> std::common_type_t<
+         std::invoke_result_t<Fun, const value_type&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+      template <std::invocable<value_type&&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+   private:
+      /**
+       * @brief Create a monad holding the value returned by `fun` when called with `args`.
+       *
+       * The returned value is constructed directly in the storage of the monad.
+       */
+      template <class Fun, class... Args>
+      constexpr maybe(detail::from_invoke_t, Fun&& fun, Args&&... args) :
+         m_is_none(false),
+         m_value(std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...))
+      {}
+
+      /**
+       * @brief `is_some()`, hinted with the `expected_outcome` of the maybe.
+       */
+      [[nodiscard]] constexpr auto expect_some() const noexcept -> bool
+      {
+         return detail::expect_success<expected_outcome_v<maybe>>(is_some());
+      }
 
    private:
       bool m_is_none = true;
@@ -384,13 +686,37 @@ namespace reglisse
 
    // clang-format on
 
+   /**
+    * @brief A maybe is trivially relocatable if its value is.
+    */
+   template <class T, class Check>
+   struct is_trivially_relocatable<maybe<T, Check>> : is_trivially_relocatable<T>
+   {
+   };
+
+   /**
+    * @brief Create a maybe holding a value constructed in place from `args`.
+    *
+    * @param args The arguments forwarded to the constructor of the value.
+    *
+    * @tparam T The type of the value.
+    * @tparam Check The check policy of the maybe.
+    */
+   template <class T, check_policy Check = default_check, class... Args>
+      requires std::constructible_from<T, Args...>
+   constexpr auto make_maybe(Args&&... args) -> maybe<T, Check>
+   {
+      return maybe<T, Check>(std::in_place, std::forward<Args>(args)...);
+   }
+
    /**
     * @brief
     */
-   template <class First, std::equality_comparable_with<First> Second>
-   constexpr auto
-   operator==(const maybe<First>& lhs,
-              const maybe<Second>& rhs) noexcept(noexcept(lhs.borrow() == rhs.borrow())) -> bool
+   template <class First, std::equality_comparable_with<First> Second, class FirstCheck,
+             class SecondCheck>
+   constexpr auto operator==(const maybe<First, FirstCheck>& lhs,
+                             const maybe<Second, SecondCheck>& rhs) noexcept(
+      noexcept(lhs.borrow() == rhs.borrow())) -> bool
    {
       if (lhs.is_some() != rhs.is_some())
       {
@@ -408,8 +734,8 @@ namespace reglisse
    /**
     * @brief
     */
-   template <class Any>
-   constexpr auto operator==(const maybe<Any>& m, none_t) noexcept -> bool
+   template <class Any, class Check>
+   constexpr auto operator==(const maybe<Any, Check>& m, none_t) noexcept -> bool
    {
       return m.is_none();
    }
@@ -417,15 +743,16 @@ namespace reglisse
    /**
     * @brief
     */
-   template <class Any, class Other>
-   constexpr auto operator==(const maybe<Any>& m,
+   template <class Any, class Check, class Other>
+   constexpr auto operator==(const maybe<Any, Check>& m,
                              const Other& value) noexcept(noexcept(m.borrow() == value)) -> bool
    {
       return m.is_some() ? m.borrow() == value : false;
    }
 
-   template <class First, class Second>
-   constexpr auto operator<=>(const maybe<First>& lhs, const maybe<Second>& rhs) noexcept(
+   template <class First, class Second, class FirstCheck, class SecondCheck>
+   constexpr auto operator<=>(const maybe<First, FirstCheck>& lhs,
+                              const maybe<Second, SecondCheck>& rhs) noexcept(
       noexcept(lhs.borrow() <=> rhs.borrow())) -> std::compare_three_way_result_t<First, Second>
    {
       if (lhs.is_some() && rhs.is_some())
@@ -436,14 +763,14 @@ namespace reglisse
       return lhs.is_some() <=> rhs.is_some();
    }
 
-   template <class Any>
-   constexpr auto operator<=>(const maybe<Any>& m, none_t) noexcept -> std::strong_ordering
+   template <class Any, class Check>
+   constexpr auto operator<=>(const maybe<Any, Check>& m, none_t) noexcept -> std::strong_ordering
    {
       return m.is_some() <=> false;
    }
 
-   template <class Any, class Other>
-   constexpr auto operator<=>(const maybe<Any>& m,
+   template <class Any, class Check, class Other>
+   constexpr auto operator<=>(const maybe<Any, Check>& m,
                               const Other& value) noexcept(noexcept(m.borrow() <=> value))
       -> std::compare_three_way_result_t<Any, Other>
    {
@@ -453,8 +780,8 @@ namespace reglisse
 
 namespace std // NOLINT
 {
-   template <class Any>
-   constexpr void swap(reglisse::maybe<Any>& lhs, reglisse::maybe<Any>& rhs)
+   template <class Any, class Check>
+   constexpr void swap(reglisse::maybe<Any, Check>& lhs, reglisse::maybe<Any, Check>& rhs)
    {
       lhs.swap(rhs);
    }
@@ -0,0 +1,470 @@
+/**
+ * @file maybe_tuple.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains maybe_tuple, a group of optional fields sharing a single presence mask.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_MAYBE_TUPLE_HPP
+#define LIBREGLISSE_MAYBE_TUPLE_HPP
+
+#include <libreglisse/detail/dispatch.hpp>
+#include <libreglisse/detail/variadic_union.hpp>
+#include <libreglisse/maybe.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   /**
+    * @brief The smallest unsigned integer type with at least `Count` bits.
+    */
+   template <std::size_t Count>
+   using smallest_mask_t = std::conditional_t<
+      (Count <= 8), std::uint8_t,
+      std::conditional_t<(Count <= 16), std::uint16_t,
+                         std::conditional_t<(Count <= 32), std::uint32_t, std::uint64_t>>>;
+
+   /**
+    * @brief Storage for a single field of a maybe_tuple, the presence of the value is tracked
+    * externally.
+    */
+   template <class T>
+   union maybe_slot
+   {
+      constexpr maybe_slot() noexcept : dummy() {}
+      constexpr ~maybe_slot() requires std::is_trivially_destructible_v<T> = default;
+      constexpr ~maybe_slot() {}
+
+      maybe_slot(const maybe_slot&) = delete;
+      maybe_slot(maybe_slot&&) = delete;
+      auto operator=(const maybe_slot&) -> maybe_slot& = delete;
+      auto operator=(maybe_slot&&) -> maybe_slot& = delete;
+
+      std::byte dummy;
+      T value;
+   };
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief A view over a single field of a maybe_tuple, offering the usual maybe interface.
+    *
+    * @tparam T The type of the field, const qualified for read-only views.
+    * @tparam Mask The type of the presence mask, const qualified for read-only views.
+    * @tparam Check The policy called when the value of an empty field is accessed.
+    */
+   template <class T, class Mask, check_policy Check = default_check>
+   class maybe_field
+   {
+   public:
+      using value_type = std::remove_const_t<T>;
+      using mask_type = std::remove_const_t<Mask>;
+      using check_type = Check;
+
+   public:
+      constexpr maybe_field(Mask& mask, mask_type bit, T* value) noexcept :
+         m_mask(&mask), m_bit(bit), m_value(value)
+      {}
+
+      [[nodiscard]] constexpr auto is_some() const noexcept -> bool
+      {
+         return (*m_mask & m_bit) != 0;
+      }
+      [[nodiscard]] constexpr auto is_none() const noexcept -> bool { return not is_some(); }
+      [[nodiscard]] constexpr explicit operator bool() const noexcept { return is_some(); }
+
+      constexpr auto borrow() const -> T&
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return *m_value;
+      }
+      constexpr auto take() const -> value_type requires(not std::is_const_v<T>)
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return std::move(*m_value);
+      }
+      template <std::convertible_to<value_type> U>
+      constexpr auto take_or(U&& or_val) const -> value_type
+      {
+         if (is_some())
+         {
+            if constexpr (std::is_const_v<T>)
+            {
+               return *m_value;
+            }
+            else
+            {
+               return std::move(*m_value);
+            }
+         }
+
+         return static_cast<value_type>(std::forward<U>(or_val));
+      }
+
+      /**
+       * @brief Destroy the value of the field, if any, and construct a new one in place from
+       * `args`.
+       */
+      template <class... Args>
+         requires(not std::is_const_v<T> and std::constructible_from<value_type, Args...>)
+      constexpr auto emplace(Args&&... args) const -> value_type&
+      {
+         reset();
+
+         std::construct_at(m_value, std::forward<Args>(args)...);
+         *m_mask |= m_bit;
+
+         return *m_value;
+      }
+      constexpr void reset() const requires(not std::is_const_v<T>)
+      {
+         if (is_some())
+         {
+            std::destroy_at(m_value);
+            *m_mask &= static_cast<mask_type>(~m_bit);
+         }
+      }
+
+      template <std::invocable<T&> Fun>
+      constexpr auto transform(Fun&& some_fun) const
+         -> maybe<std::remove_cvref_t<std::invoke_result_t<Fun, T&>>, check_type>
+      {
+         if (is_some())
+         {
+            return maybe<std::remove_cvref_t<std::invoke_result_t<Fun, T&>>, check_type>(
+               std::in_place, std::invoke(std::forward<Fun>(some_fun), *m_value));
+         }
+
+         return none;
+      }
+      template <std::invocable<T&> Fun>
+      constexpr auto and_then(Fun&& some_fun) const -> std::invoke_result_t<Fun, T&>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), *m_value);
+         }
+
+         return none;
+      }
+      template <std::invocable<T&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) const
+         -> std::common_type_t<std::invoke_result_t<Fun, T&>, std::invoke_result_t<Def>>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), *m_value);
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+      /**
+       * @brief Copy the field into a standalone maybe.
+       */
+      constexpr auto to_maybe() const -> maybe<value_type, check_type>
+         requires std::copy_constructible<value_type>
+      {
+         if (is_some())
+         {
+            return maybe<value_type, check_type>(std::in_place, *m_value);
+         }
+
+         return none;
+      }
+
+   private:
+      Mask* m_mask;
+      mask_type m_bit;
+      T* m_value;
+   };
+
+   /**
+    * @brief A group of optional fields whose presence flags are packed in a single mask.
+    *
+    * Each field takes the space of its value only, without the flag and padding a maybe adds.
+    * Checking the presence of a set of fields is a single AND against a constant mask.
+    *
+    * @code
+    * using record = maybe_tuple<std::uint32_t, std::string, double>;
+    *
+    * record rec;
+    * rec.emplace<1>("name");
+    *
+    * if (rec.all_of<0, 1>()) { ... }
+    * @endcode
+    *
+    * @tparam Check The policy called when the value of an empty field is accessed.
+    * @tparam Ts The types of the fields.
+    */
+   template <check_policy Check, std::destructible... Ts>
+      requires(sizeof...(Ts) > 0 and sizeof...(Ts) <= 64 and not(std::is_reference_v<Ts> or ...))
+   class basic_maybe_tuple
+   {
+      static constexpr std::size_t field_count = sizeof...(Ts);
+
+   public:
+      using mask_type = detail::smallest_mask_t<field_count>;
+      using check_type = Check;
+
+      template <std::size_t I>
+      using field_type = detail::nth_type_t<I, Ts...>;
+
+      /**
+       * @brief The mask with the bits of the fields `Is` set.
+       */
+      template <std::size_t... Is>
+         requires((Is < field_count) and ...)
+      static constexpr mask_type mask_of =
+         static_cast<mask_type>((mask_type(0) | ... | static_cast<mask_type>(mask_type(1) << Is)));
+
+   public:
+      /**
+       * @brief Create a maybe_tuple where every field is empty.
+       */
+      constexpr basic_maybe_tuple() noexcept {} // NOLINT
+      /**
+       * @brief Create a maybe_tuple from one maybe per field.
+       */
+      constexpr explicit basic_maybe_tuple(maybe<Ts, check_type>&&... fields)
+         requires(std::move_constructible<Ts> and ...)
+      {
+         guarded_init([&] {
+            init_from(std::index_sequence_for<Ts...>{}, std::move(fields)...);
+         });
+      }
+      constexpr basic_maybe_tuple(const basic_maybe_tuple& other) requires(
+         std::copy_constructible<Ts> and ...)
+      {
+         guarded_init([&] {
+            for_each_field([&]<std::size_t I>(detail::index_constant<I>) {
+               if (other.is_some<I>())
+               {
+                  construct<I>(other.value<I>());
+               }
+            });
+         });
+      }
+      constexpr basic_maybe_tuple(basic_maybe_tuple&& other) noexcept(
+         (std::is_nothrow_move_constructible_v<Ts> and ...))
+         requires(std::move_constructible<Ts> and ...)
+      {
+         guarded_init([&] {
+            for_each_field([&]<std::size_t I>(detail::index_constant<I>) {
+               if (other.is_some<I>())
+               {
+                  construct<I>(std::move(other.value<I>()));
+               }
+            });
+         });
+      }
+      constexpr ~basic_maybe_tuple() { reset(); }
+
+      constexpr auto operator=(const basic_maybe_tuple& rhs)
+         -> basic_maybe_tuple& requires(std::copy_constructible<Ts> and ...)
+      {
+         if (this != &rhs)
+         {
+            reset();
+
+            for_each_field([&]<std::size_t I>(detail::index_constant<I>) {
+               if (rhs.is_some<I>())
+               {
+                  construct<I>(rhs.value<I>());
+               }
+            });
+         }
+
+         return *this;
+      }
+      constexpr auto operator=(basic_maybe_tuple&& rhs) noexcept(
+         (std::is_nothrow_move_constructible_v<Ts> and ...))
+         -> basic_maybe_tuple& requires(std::move_constructible<Ts> and ...)
+      {
+         if (this != &rhs)
+         {
+            reset();
+
+            for_each_field([&]<std::size_t I>(detail::index_constant<I>) {
+               if (rhs.is_some<I>())
+               {
+                  construct<I>(std::move(rhs.value<I>()));
+               }
+            });
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief Access the `I`th field as a maybe-like view.
+       */
+      template <std::size_t I>
+         requires(I < field_count)
+      constexpr auto get() & noexcept -> maybe_field<field_type<I>, mask_type, check_type>
+      {
+         return {m_mask, mask_of<I>, &std::get<I>(m_slots).value};
+      }
+      template <std::size_t I>
+         requires(I < field_count)
+      constexpr auto get() const& noexcept
+         -> maybe_field<const field_type<I>, const mask_type, check_type>
+      {
+         return {m_mask, mask_of<I>, &std::get<I>(m_slots).value};
+      }
+
+      template <std::size_t I>
+         requires(I < field_count)
+      [[nodiscard]] constexpr auto is_some() const noexcept -> bool
+      {
+         return (m_mask & mask_of<I>) != 0;
+      }
+      template <std::size_t I>
+         requires(I < field_count)
+      [[nodiscard]] constexpr auto is_none() const noexcept -> bool
+      {
+         return not is_some<I>();
+      }
+
+      template <std::size_t I, class... Args>
+         requires(I < field_count and std::constructible_from<field_type<I>, Args...>)
+      constexpr auto emplace(Args&&... args) -> field_type<I>&
+      {
+         return get<I>().emplace(std::forward<Args>(args)...);
+      }
+      template <std::size_t I>
+         requires(I < field_count)
+      constexpr void reset()
+      {
+         get<I>().reset();
+      }
+      /**
+       * @brief Empty every field.
+       */
+      constexpr void reset()
+      {
+         for_each_field([&]<std::size_t I>(detail::index_constant<I>) {
+            reset<I>();
+         });
+      }
+
+      /**
+       * @brief The presence mask, where the `I`th bit is set if the `I`th field holds a value.
+       */
+      [[nodiscard]] constexpr auto mask() const noexcept -> mask_type { return m_mask; }
+
+      /**
+       * @brief Check if every field of `required` holds a value.
+       */
+      [[nodiscard]] constexpr auto contains(mask_type required) const noexcept -> bool
+      {
+         return (m_mask & required) == required;
+      }
+      /**
+       * @brief Check if every one of the fields `Is` holds a value.
+       */
+      template <std::size_t... Is>
+      [[nodiscard]] constexpr auto all_of() const noexcept -> bool
+      {
+         return contains(mask_of<Is...>);
+      }
+      /**
+       * @brief Check if at least one of the fields `Is` holds a value.
+       */
+      template <std::size_t... Is>
+      [[nodiscard]] constexpr auto any_of() const noexcept -> bool
+      {
+         return (m_mask & mask_of<Is...>) != 0;
+      }
+
+   private:
+      template <class Fun>
+      static constexpr void for_each_field(Fun&& fun)
+      {
+         [&]<std::size_t... Is>(std::index_sequence<Is...>)
+         {
+            (std::invoke(fun, detail::index_constant<Is>{}), ...);
+         }
+         (std::index_sequence_for<Ts...>{});
+      }
+
+      /**
+       * @brief Run `init`, which constructs the fields of a maybe_tuple being constructed. The
+       * destructor does not run when a constructor throws, so the fields already built are
+       * destroyed here before rethrowing.
+       */
+      template <class Init>
+      constexpr void guarded_init(Init&& init)
+      {
+#if defined(__cpp_exceptions)
+         try
+         {
+            std::invoke(std::forward<Init>(init));
+         }
+         catch (...)
+         {
+            reset();
+            throw;
+         }
+#else
+         std::invoke(std::forward<Init>(init));
+#endif // defined(__cpp_exceptions)
+      }
+
+      template <std::size_t... Is>
+      constexpr void init_from(std::index_sequence<Is...>, maybe<Ts, check_type>&&... fields)
+      {
+         (
+            [&] {
+               if (fields.is_some())
+               {
+                  construct<Is>(std::move(fields).take());
+               }
+            }(),
+            ...);
+      }
+
+      template <std::size_t I>
+      constexpr auto value() & -> field_type<I>&
+      {
+         return std::get<I>(m_slots).value; // NOLINT
+      }
+      template <std::size_t I>
+      constexpr auto value() const& -> const field_type<I>&
+      {
+         return std::get<I>(m_slots).value; // NOLINT
+      }
+
+      template <std::size_t I, class... Args>
+      constexpr void construct(Args&&... args)
+      {
+         std::construct_at(&std::get<I>(m_slots).value, std::forward<Args>(args)...);
+         m_mask |= mask_of<I>;
+      }
+
+   private:
+      mask_type m_mask{};
+
+      std::tuple<detail::maybe_slot<Ts>...> m_slots{};
+   };
+
+   /**
+    * @brief A basic_maybe_tuple using the default check policy.
+    */
+   template <class... Ts>
+   using maybe_tuple = basic_maybe_tuple<default_check, Ts...>;
+} // namespace reglisse
+
+#endif // LIBREGLISSE_MAYBE_TUPLE_HPP
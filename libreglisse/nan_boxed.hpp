@@ -0,0 +1,308 @@
+/**
+ * @file nan_boxed.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains eight byte representations of either and result where one side is a double.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_NAN_BOXED_HPP
+#define LIBREGLISSE_NAN_BOXED_HPP
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/result.hpp>
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Types that fit in the 48 bit payload of a NaN: integers and enumerations of at most
+    * 32 bits, and pointers.
+    */
+   template <class T>
+   concept nan_boxable = ((std::integral<T> or std::is_enum_v<T>) and sizeof(T) <= 4) or
+      std::is_pointer_v<T>;
+
+   template <class L, class R>
+   concept nan_boxable_pair = (std::same_as<L, double> and nan_boxable<R>) or
+      (std::same_as<R, double> and nan_boxable<L>);
+
+   /**
+    * @brief Boxed values are stored in negative quiet NaNs whose top 16 bits are `nan_box_tag`.
+    * Doubles are never stored with that pattern.
+    */
+   inline constexpr std::uint64_t nan_box_tag = 0xFFF9'0000'0000'0000;
+   inline constexpr std::uint64_t nan_box_tag_mask = 0xFFFF'0000'0000'0000;
+
+   template <check_policy Check = default_check>
+   constexpr void handle_unboxable_pointer(bool check)
+   {
+      Check::check(check, "pointer does not fit in 48 bits");
+   }
+
+   template <std::size_t Size>
+   using unsigned_of_size_t = std::conditional_t<
+      (Size == 1), std::uint8_t, std::conditional_t<(Size == 2), std::uint16_t, std::uint32_t>>;
+
+   constexpr auto is_nan_boxed(std::uint64_t bits) noexcept -> bool
+   {
+      return (bits & nan_box_tag_mask) == nan_box_tag;
+   }
+
+   /**
+    * @brief The bits of `value`. A NaN colliding with the tag is replaced by the canonical
+    * quiet NaN, every other double keeps its exact representation.
+    */
+   constexpr auto box_double(double value) noexcept -> std::uint64_t
+   {
+      const auto bits = std::bit_cast<std::uint64_t>(value);
+
+      if (is_nan_boxed(bits))
+      {
+         return std::bit_cast<std::uint64_t>(std::numeric_limits<double>::quiet_NaN());
+      }
+
+      return bits;
+   }
+
+   /**
+    * @brief The bits of `value` tagged as a boxed value. The address of a pointer is checked with
+    * `Check` to fit in the 48 bit payload.
+    */
+   template <check_policy Check, nan_boxable T>
+   constexpr auto box_value(T value) -> std::uint64_t
+   {
+      if constexpr (std::is_pointer_v<T>)
+      {
+         const auto address = reinterpret_cast<std::uintptr_t>(value); // NOLINT
+
+         handle_unboxable_pointer<Check>((address & nan_box_tag_mask) == 0);
+
+         return nan_box_tag | address;
+      }
+      else
+      {
+         return nan_box_tag | std::bit_cast<unsigned_of_size_t<sizeof(T)>>(value);
+      }
+   }
+
+   template <check_policy Check, class T>
+   constexpr auto box(T value) -> std::uint64_t
+   {
+      if constexpr (std::same_as<T, double>)
+      {
+         return box_double(value);
+      }
+      else
+      {
+         return box_value<Check>(value);
+      }
+   }
+
+   template <class T>
+   constexpr auto unbox(std::uint64_t bits) noexcept -> T
+   {
+      if constexpr (std::same_as<T, double>)
+      {
+         return std::bit_cast<double>(bits);
+      }
+      else if constexpr (std::is_pointer_v<T>)
+      {
+         const auto address = static_cast<std::uintptr_t>(bits & ~nan_box_tag_mask);
+
+         return reinterpret_cast<T>(address); // NOLINT
+      }
+      else
+      {
+         return std::bit_cast<T>(static_cast<unsigned_of_size_t<sizeof(T)>>(bits));
+      }
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief An either of a double and a small value, packed in the bits of a double.
+    *
+    * The small value is stored in the payload of a NaN, so the whole either takes 8 bytes instead
+    * of 16. Every double except NaNs round-trips exactly, NaNs may come back as the canonical
+    * quiet NaN. Values are returned by copy, since the stored bits are not an object of the
+    * held type.
+    *
+    * @tparam L The left type, either `double` or a small integer, enumeration or pointer.
+    * @tparam R The right type, either `double` or a small integer, enumeration or pointer.
+    * @tparam Check The policy called on invalid accesses and on pointers that do not fit.
+    */
+   template <class L, class R, check_policy Check = default_check>
+      requires detail::nan_boxable_pair<L, R>
+   class nan_boxed_either
+   {
+   public:
+      using left_type = L;
+      using right_type = R;
+      using check_type = Check;
+
+   public:
+      constexpr nan_boxed_either(left<left_type>&& left_val) :
+         m_bits(detail::box<check_type>(std::move(left_val).value()))
+      {}
+      constexpr nan_boxed_either(right<right_type>&& right_val) :
+         m_bits(detail::box<check_type>(std::move(right_val).value()))
+      {}
+      constexpr explicit nan_boxed_either(const either<left_type, right_type, check_type>& other) :
+         m_bits(other.is_left() ? detail::box<check_type>(other.borrow_left())
+                                : detail::box<check_type>(other.borrow_right()))
+      {}
+
+      [[nodiscard]] constexpr auto is_left() const noexcept -> bool
+      {
+         return detail::is_nan_boxed(m_bits) != std::same_as<left_type, double>;
+      }
+      [[nodiscard]] constexpr auto is_right() const noexcept -> bool { return not is_left(); }
+
+      constexpr auto take_left() const -> left_type
+      {
+         detail::handle_invalid_left_either_access<check_type>(is_left());
+
+         return detail::unbox<left_type>(m_bits);
+      }
+      constexpr auto take_right() const -> right_type
+      {
+         detail::handle_invalid_right_either_access<check_type>(is_right());
+
+         return detail::unbox<right_type>(m_bits);
+      }
+
+      template <std::invocable<left_type> LeftFun, std::invocable<right_type> RightFun>
+      constexpr auto match(LeftFun&& left_fun, RightFun&& right_fun) const
+         -> std::common_type_t<std::invoke_result_t<LeftFun, left_type>,
+                               std::invoke_result_t<RightFun, right_type>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<LeftFun>(left_fun),
+                               detail::unbox<left_type>(m_bits));
+         }
+
+         return std::invoke(std::forward<RightFun>(right_fun), detail::unbox<right_type>(m_bits));
+      }
+
+      /**
+       * @brief Unpack into a regular either.
+       */
+      constexpr auto to_either() const -> either<left_type, right_type, check_type>
+      {
+         using either_type = either<left_type, right_type, check_type>;
+
+         if (is_left())
+         {
+            return either_type(in_place_left, detail::unbox<left_type>(m_bits));
+         }
+
+         return either_type(in_place_right, detail::unbox<right_type>(m_bits));
+      }
+
+   private:
+      std::uint64_t m_bits;
+   };
+
+   /**
+    * @brief A result of a double and a small value, packed in the bits of a double.
+    *
+    * See `nan_boxed_either` for the representation.
+    *
+    * @tparam ValueType The value type, either `double` or a small integer, enumeration or pointer.
+    * @tparam ErrorType The error type, either `double` or a small integer, enumeration or pointer.
+    * @tparam Check The policy called on invalid accesses and on pointers that do not fit.
+    */
+   template <class ValueType, class ErrorType, check_policy Check = default_check>
+      requires detail::nan_boxable_pair<ValueType, ErrorType>
+   class nan_boxed_result
+   {
+   public:
+      using value_type = ValueType;
+      using error_type = ErrorType;
+      using check_type = Check;
+
+   public:
+      constexpr nan_boxed_result(ok<value_type>&& value) :
+         m_bits(detail::box<check_type>(std::move(value).value()))
+      {}
+      constexpr nan_boxed_result(err<error_type>&& error) :
+         m_bits(detail::box<check_type>(std::move(error).value()))
+      {}
+      constexpr explicit nan_boxed_result(const result<value_type, error_type, check_type>& other) :
+         m_bits(other.is_ok() ? detail::box<check_type>(other.borrow())
+                              : detail::box<check_type>(other.borrow_err()))
+      {}
+
+      [[nodiscard]] constexpr auto is_ok() const noexcept -> bool
+      {
+         return detail::is_nan_boxed(m_bits) != std::same_as<value_type, double>;
+      }
+      [[nodiscard]] constexpr auto is_err() const noexcept -> bool { return not is_ok(); }
+      constexpr explicit operator bool() const noexcept { return is_ok(); }
+
+      constexpr auto take() const -> value_type
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return detail::unbox<value_type>(m_bits);
+      }
+      template <std::convertible_to<value_type> U>
+      constexpr auto take_or(U&& other) const -> value_type
+      {
+         if (is_ok())
+         {
+            return detail::unbox<value_type>(m_bits);
+         }
+
+         return static_cast<value_type>(std::forward<U>(other));
+      }
+      constexpr auto take_err() const -> error_type
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return detail::unbox<error_type>(m_bits);
+      }
+
+      template <std::invocable<value_type> OkFun, std::invocable<error_type> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) const
+         -> std::common_type_t<std::invoke_result_t<OkFun, value_type>,
+                               std::invoke_result_t<ErrFun, error_type>>
+      {
+         if (is_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), detail::unbox<value_type>(m_bits));
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), detail::unbox<error_type>(m_bits));
+      }
+
+      /**
+       * @brief Unpack into a regular result.
+       */
+      constexpr auto to_result() const -> result<value_type, error_type, check_type>
+      {
+         using result_type = result<value_type, error_type, check_type>;
+
+         if (is_ok())
+         {
+            return result_type(in_place_ok, detail::unbox<value_type>(m_bits));
+         }
+
+         return result_type(in_place_err, detail::unbox<error_type>(m_bits));
+      }
+
+   private:
+      std::uint64_t m_bits;
+   };
+} // namespace reglisse
+
+#endif // LIBREGLISSE_NAN_BOXED_HPP
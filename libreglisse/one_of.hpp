@@ -0,0 +1,561 @@
+/**
+ * @file one_of.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the one_of monad, an n-ary sibling of either.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ONE_OF_HPP
+#define LIBREGLISSE_ONE_OF_HPP
+
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/dispatch.hpp>
+#include <libreglisse/detail/variadic_union.hpp>
+#include <libreglisse/relocate.hpp>
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_one_of_access(bool check)
+   {
+      Check::check(check, "one_of holds another alternative");
+   }
+
+   template <check_policy Check = default_check>
+   constexpr void handle_valueless_one_of_access(bool check)
+   {
+      Check::check(check, "one_of lost its alternative to a throwing move");
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   template <check_policy Check, std::destructible... Ts>
+      requires(sizeof...(Ts) > 0 and not(std::is_reference_v<Ts> or ...))
+   class basic_one_of;
+
+   /**
+    * @brief Holds the value of the `I`th alternative of a one_of, see `at`.
+    */
+   template <std::size_t I, std::movable T>
+      requires(not std::is_reference_v<T>)
+   class alternative
+   {
+   public:
+      using value_type = T;
+
+      static constexpr std::size_t index = I;
+
+   public:
+      explicit constexpr alternative(value_type&& value) : m_value(std::move(value)) {}
+
+      constexpr auto value() const& noexcept -> const value_type& { return m_value; }
+      constexpr auto value() & noexcept -> value_type& { return m_value; }
+      constexpr auto value() const&& noexcept -> const value_type { return std::move(m_value); }
+      constexpr auto value() && noexcept -> value_type { return std::move(m_value); }
+
+      template <std::size_t J, std::equality_comparable_with<value_type> U>
+      constexpr auto operator==(const alternative<J, U>& rhs) const -> bool
+      {
+         return I == J && value() == rhs.value();
+      }
+
+   private:
+      value_type m_value;
+   };
+
+   /**
+    * @brief Tag `value` as the `I`th alternative of a one_of.
+    *
+    * @code
+    * one_of<int, float, std::string> msg = at<2>(std::string("hello"));
+    * @endcode
+    */
+   template <std::size_t I, class T>
+   constexpr auto at(T&& value) -> alternative<I, std::remove_cvref_t<T>>
+   {
+      return alternative<I, std::remove_cvref_t<T>>(std::remove_cvref_t<T>(std::forward<T>(value)));
+   }
+
+   /**
+    * @brief A tagged union of any number of types.
+    *
+    * All alternatives share the same storage and the active one is tracked using the smallest
+    * possible tag. Every operation dispatching on the active alternative goes through a single
+    * dense switch, lowered to a jump table by the compiler.
+    *
+    * @tparam Check The policy called when an alternative other than the active one is accessed.
+    * @tparam Ts The types of the alternatives.
+    */
+   template <check_policy Check, std::destructible... Ts>
+      requires(sizeof...(Ts) > 0 and not(std::is_reference_v<Ts> or ...))
+   class basic_one_of
+   {
+      template <check_policy OtherCheck, std::destructible... Us>
+         requires(sizeof...(Us) > 0 and not(std::is_reference_v<Us> or ...))
+      friend class basic_one_of;
+
+      static constexpr std::size_t alternative_count = sizeof...(Ts);
+
+      using index_type = detail::smallest_index_t<alternative_count>;
+
+      static constexpr bool may_be_valueless =
+         not(std::is_nothrow_move_constructible_v<Ts> and ...);
+      static constexpr auto valueless_index = static_cast<index_type>(alternative_count);
+
+      template <std::size_t I, class U, class Indices>
+      struct replace_at;
+
+      template <std::size_t I, class U, std::size_t... Js>
+      struct replace_at<I, U, std::index_sequence<Js...>>
+      {
+         using type = basic_one_of<Check, std::conditional_t<Js == I, U, Ts>...>;
+      };
+
+   public:
+      using check_type = Check;
+
+      template <std::size_t I>
+      using alternative_type = detail::nth_type_t<I, Ts...>;
+
+      template <std::size_t I, class Fun, class Self>
+      using transform_at_result = typename replace_at<
+         I,
+         std::remove_cvref_t<
+            std::invoke_result_t<Fun, decltype(detail::get<I>(std::declval<Self>()))>>,
+         std::index_sequence_for<Ts...>>::type;
+
+   public:
+      constexpr basic_one_of() = delete;
+      template <std::size_t I, class T>
+         requires std::same_as<T, alternative_type<I>>
+      constexpr basic_one_of(alternative<I, T>&& value) :
+         m_index(I), m_storage(std::in_place_index<I>, std::move(value).value())
+      {}
+      /**
+       * @brief Construct the `I`th alternative in place from `args`.
+       */
+      template <std::size_t I, class... Args>
+         requires(I < alternative_count and std::constructible_from<alternative_type<I>, Args...>)
+      constexpr explicit basic_one_of(std::in_place_index_t<I>, Args&&... args) :
+         m_index(I), m_storage(std::in_place_index<I>, std::forward<Args>(args)...)
+      {}
+      constexpr basic_one_of(const basic_one_of& other) requires(
+         std::copy_constructible<Ts> and ...)
+      {
+         if (other.valueless_by_exception())
+         {
+            m_index = valueless_index;
+
+            return;
+         }
+
+         detail::dispatch<void, alternative_count>(other.m_index, [&]<std::size_t I>(
+                                                                     detail::index_constant<I>) {
+            construct<I>(detail::get<I>(other.m_storage));
+         });
+      }
+      constexpr basic_one_of(basic_one_of&& other) noexcept(
+         (std::is_nothrow_move_constructible_v<Ts> and ...))
+         requires(std::move_constructible<Ts> and ...)
+      {
+         if (other.valueless_by_exception())
+         {
+            m_index = valueless_index;
+
+            return;
+         }
+
+         detail::dispatch<void, alternative_count>(other.m_index, [&]<std::size_t I>(
+                                                                     detail::index_constant<I>) {
+            construct<I>(detail::get<I>(std::move(other.m_storage)));
+         });
+      }
+      constexpr ~basic_one_of() { destroy(); }
+
+      constexpr auto operator=(const basic_one_of& rhs)
+         -> basic_one_of& requires(std::copy_constructible<Ts> and ...)
+      {
+         if (this != &rhs)
+         {
+            if (rhs.valueless_by_exception())
+            {
+               destroy();
+               m_index = valueless_index;
+
+               return *this;
+            }
+
+            detail::dispatch<void, alternative_count>(rhs.m_index, [&]<std::size_t I>(
+                                                                      detail::index_constant<I>) {
+               replace<I>(detail::get<I>(rhs.m_storage));
+            });
+         }
+
+         return *this;
+      }
+      constexpr auto operator=(basic_one_of&& rhs) noexcept(
+         (std::is_nothrow_move_constructible_v<Ts> and ...))
+         -> basic_one_of& requires(std::move_constructible<Ts> and ...)
+      {
+         if (this != &rhs)
+         {
+            if (rhs.valueless_by_exception())
+            {
+               destroy();
+               m_index = valueless_index;
+
+               return *this;
+            }
+
+            detail::dispatch<void, alternative_count>(rhs.m_index, [&]<std::size_t I>(
+                                                                      detail::index_constant<I>) {
+               replace<I>(detail::get<I>(std::move(rhs.m_storage)));
+            });
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief The index of the active alternative, or the number of alternatives if the one_of is
+       * valueless.
+       */
+      [[nodiscard]] constexpr auto index() const noexcept -> std::size_t { return m_index; }
+
+      /**
+       * @brief Check if an assignment lost the active alternative.
+       *
+       * Assignments keep the active alternative when building the new one throws. Only when an
+       * alternative may throw on move, and its move into the storage does, is the one_of left
+       * without a value. It may then only be assigned to, copied, compared or destroyed.
+       */
+      [[nodiscard]] constexpr auto valueless_by_exception() const noexcept -> bool
+      {
+         if constexpr (may_be_valueless)
+         {
+            return m_index == valueless_index;
+         }
+         else
+         {
+            return false;
+         }
+      }
+
+      /**
+       * @brief Check if the `I`th alternative is the active one.
+       */
+      template <std::size_t I>
+         requires(I < alternative_count)
+      [[nodiscard]] constexpr auto is() const noexcept -> bool
+      {
+         return m_index == I;
+      }
+
+      template <std::size_t I>
+         requires(I < alternative_count)
+      constexpr auto borrow() const& -> const alternative_type<I>&
+      {
+         detail::handle_invalid_one_of_access<check_type>(is<I>());
+
+         return detail::get<I>(m_storage);
+      }
+      template <std::size_t I>
+         requires(I < alternative_count)
+      constexpr auto borrow() & -> alternative_type<I>&
+      {
+         detail::handle_invalid_one_of_access<check_type>(is<I>());
+
+         return detail::get<I>(m_storage);
+      }
+      template <std::size_t I>
+         requires(I < alternative_count)
+      constexpr auto take() const&& -> alternative_type<I>
+      {
+         detail::handle_invalid_one_of_access<check_type>(is<I>());
+
+         return detail::get<I>(m_storage);
+      }
+      template <std::size_t I>
+         requires(I < alternative_count)
+      constexpr auto take() && -> alternative_type<I>
+      {
+         detail::handle_invalid_one_of_access<check_type>(is<I>());
+
+         return detail::get<I>(std::move(m_storage));
+      }
+
+      /**
+       * @brief Destroy the active alternative and construct the `I`th one in place from `args`.
+       *
+       * If the constructor throws, the active alternative is kept. Only an alternative that cannot
+       * be built in a temporary and moved in without throwing may leave the one_of valueless.
+       *
+       * @return A reference to the newly constructed alternative.
+       */
+      template <std::size_t I, class... Args>
+         requires(I < alternative_count and std::constructible_from<alternative_type<I>, Args...>)
+      constexpr auto emplace(Args&&... args) -> alternative_type<I>&
+      {
+         replace<I>(std::forward<Args>(args)...);
+
+         return detail::get<I>(m_storage);
+      }
+
+      /**
+       * @brief Transform the value of the `I`th alternative if it is the active one.
+       *
+       * The lvalue overloads pass the value by reference and copy the other alternatives, the
+       * rvalue overload moves them.
+       *
+       * @return A one_of where the `I`th alternative is replaced by the return type of `fun`.
+       */
+      template <std::size_t I, class Fun>
+         requires(I < alternative_count and std::invocable<Fun, alternative_type<I>&>)
+      constexpr auto transform_at(Fun&& fun) &
+         -> transform_at_result<I, Fun, detail::variadic_union<Ts...>&>
+      {
+         using ret = transform_at_result<I, Fun, detail::variadic_union<Ts...>&>;
+
+         detail::handle_valueless_one_of_access<check_type>(not valueless_by_exception());
+
+         return detail::dispatch<ret, alternative_count>(
+            m_index, [&]<std::size_t J>(detail::index_constant<J>) -> ret {
+               if constexpr (I == J)
+               {
+                  return ret(std::in_place_index<J>,
+                             std::invoke(std::forward<Fun>(fun), detail::get<J>(m_storage)));
+               }
+               else
+               {
+                  return ret(std::in_place_index<J>, detail::get<J>(m_storage));
+               }
+            });
+      }
+      template <std::size_t I, class Fun>
+         requires(I < alternative_count and std::invocable<Fun, const alternative_type<I>&>)
+      constexpr auto transform_at(Fun&& fun) const&
+         -> transform_at_result<I, Fun, const detail::variadic_union<Ts...>&>
+      {
+         using ret = transform_at_result<I, Fun, const detail::variadic_union<Ts...>&>;
+
+         detail::handle_valueless_one_of_access<check_type>(not valueless_by_exception());
+
+         return detail::dispatch<ret, alternative_count>(
+            m_index, [&]<std::size_t J>(detail::index_constant<J>) -> ret {
+               if constexpr (I == J)
+               {
+                  return ret(std::in_place_index<J>,
+                             std::invoke(std::forward<Fun>(fun), detail::get<J>(m_storage)));
+               }
+               else
+               {
+                  return ret(std::in_place_index<J>, detail::get<J>(m_storage));
+               }
+            });
+      }
+      template <std::size_t I, class Fun>
+         requires(I < alternative_count and std::invocable<Fun, alternative_type<I>&&>)
+      constexpr auto transform_at(Fun&& fun) &&
+         -> transform_at_result<I, Fun, detail::variadic_union<Ts...>&&>
+      {
+         using ret = transform_at_result<I, Fun, detail::variadic_union<Ts...>&&>;
+
+         detail::handle_valueless_one_of_access<check_type>(not valueless_by_exception());
+
+         return detail::dispatch<ret, alternative_count>(
+            m_index, [&]<std::size_t J>(detail::index_constant<J>) -> ret {
+               if constexpr (I == J)
+               {
+                  return ret(std::in_place_index<J>,
+                             std::invoke(std::forward<Fun>(fun),
+                                         detail::get<J>(std::move(m_storage))));
+               }
+               else
+               {
+                  return ret(std::in_place_index<J>, detail::get<J>(std::move(m_storage)));
+               }
+            });
+      }
+
+      /**
+       * @brief Call the callable matching the active alternative.
+       *
+       * Either a single overload set invocable with every alternative, or one callable per
+       * alternative, in order. The tag is only tested once, by a jump table, and the value is
+       * passed by reference following the value category of the one_of.
+       */
+      template <class... Funs>
+         requires(sizeof...(Funs) == 1 or sizeof...(Funs) == alternative_count)
+      constexpr auto match(Funs&&... funs) & -> decltype(auto)
+      {
+         detail::handle_valueless_one_of_access<check_type>(not valueless_by_exception());
+
+         return match_impl(m_index, m_storage, std::index_sequence_for<Ts...>(),
+                           std::forward<Funs>(funs)...);
+      }
+      template <class... Funs>
+         requires(sizeof...(Funs) == 1 or sizeof...(Funs) == alternative_count)
+      constexpr auto match(Funs&&... funs) const& -> decltype(auto)
+      {
+         detail::handle_valueless_one_of_access<check_type>(not valueless_by_exception());
+
+         return match_impl(m_index, m_storage, std::index_sequence_for<Ts...>(),
+                           std::forward<Funs>(funs)...);
+      }
+      template <class... Funs>
+         requires(sizeof...(Funs) == 1 or sizeof...(Funs) == alternative_count)
+      constexpr auto match(Funs&&... funs) && -> decltype(auto)
+      {
+         detail::handle_valueless_one_of_access<check_type>(not valueless_by_exception());
+
+         return match_impl(m_index, std::move(m_storage), std::index_sequence_for<Ts...>(),
+                           std::forward<Funs>(funs)...);
+      }
+
+      constexpr auto operator==(const basic_one_of& rhs) const
+         -> bool requires(std::equality_comparable<Ts> and ...)
+      {
+         if (m_index != rhs.m_index)
+         {
+            return false;
+         }
+
+         if (valueless_by_exception())
+         {
+            return true;
+         }
+
+         return detail::dispatch<bool, alternative_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+               return detail::get<I>(m_storage) == detail::get<I>(rhs.m_storage);
+            });
+      }
+
+   private:
+      template <std::size_t I, class... Funs>
+      static constexpr auto nth_fun(Funs&&... funs) -> decltype(auto)
+      {
+         if constexpr (sizeof...(Funs) == 1)
+         {
+            return (std::forward<Funs>(funs), ...);
+         }
+         else
+         {
+            return std::get<I>(std::forward_as_tuple(std::forward<Funs>(funs)...));
+         }
+      }
+
+      template <class Storage, std::size_t... Is, class... Funs>
+      static constexpr auto match_impl(std::size_t index, Storage&& storage,
+                                       std::index_sequence<Is...>, Funs&&... funs)
+         -> decltype(auto)
+      {
+         using ret = std::common_type_t<decltype(std::invoke(
+            nth_fun<Is>(std::forward<Funs>(funs)...),
+            detail::get<Is>(std::forward<Storage>(storage))))...>;
+
+         return detail::dispatch<ret, alternative_count>(
+            index, [&]<std::size_t I>(detail::index_constant<I>) -> ret {
+               return std::invoke(nth_fun<I>(std::forward<Funs>(funs)...),
+                                  detail::get<I>(std::forward<Storage>(storage)));
+            });
+      }
+
+      template <std::size_t I, class... Args>
+      constexpr void construct(Args&&... args)
+      {
+         std::construct_at(&m_storage, std::in_place_index<I>, std::forward<Args>(args)...);
+         m_index = static_cast<index_type>(I);
+      }
+
+      /**
+       * @brief Destroy the active alternative and construct the `I`th one from `args`.
+       *
+       * A constructor that may throw builds the new alternative in a temporary first, so that the
+       * active one is only destroyed once the temporary exists. If moving the temporary in may
+       * throw as well, or the alternative cannot be moved, the one_of is marked valueless in
+       * between.
+       */
+      template <std::size_t I, class... Args>
+      constexpr void replace(Args&&... args)
+      {
+         using value_type = alternative_type<I>;
+
+         if constexpr (std::is_nothrow_constructible_v<value_type, Args...>)
+         {
+            destroy();
+            construct<I>(std::forward<Args>(args)...);
+         }
+         else if constexpr (std::move_constructible<value_type>)
+         {
+            value_type value(std::forward<Args>(args)...);
+
+            destroy();
+
+            if constexpr (not std::is_nothrow_move_constructible_v<value_type>)
+            {
+               m_index = valueless_index;
+            }
+
+            construct<I>(std::move(value));
+         }
+         else
+         {
+            destroy();
+            m_index = valueless_index;
+            construct<I>(std::forward<Args>(args)...);
+         }
+      }
+
+      constexpr void destroy()
+      {
+         if (valueless_by_exception())
+         {
+            return;
+         }
+
+         detail::dispatch<void, alternative_count>(m_index, [&]<std::size_t I>(
+                                                               detail::index_constant<I>) {
+            std::destroy_at(&detail::get<I>(m_storage));
+         });
+      }
+
+   private:
+      index_type m_index{};
+
+      detail::variadic_union<Ts...> m_storage{};
+   };
+
+   /**
+    * @brief Deduce the alternatives from another one_of. The implicit guides of the copy and move
+    * constructors are ambiguous when deducing through the `one_of` alias with GCC 12.
+    */
+   template <check_policy Check, class... Ts>
+   basic_one_of(basic_one_of<Check, Ts...>) -> basic_one_of<Check, Ts...>;
+
+   /**
+    * @brief A basic_one_of using the default check policy.
+    */
+   template <class... Ts>
+   using one_of = basic_one_of<default_check, Ts...>;
+
+   /**
+    * @brief A one_of is trivially relocatable if all of its alternatives are.
+    */
+   template <class Check, class... Ts>
+   struct is_trivially_relocatable<basic_one_of<Check, Ts...>> :
+      std::bool_constant<(is_trivially_relocatable_v<Ts> and ...)>
+   {
+   };
+} // namespace reglisse
+
+#endif // LIBREGLISSE_ONE_OF_HPP
@@ -0,0 +1,164 @@
+/**
+ * @file optional_view.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains optional_view, the maybe interface over an existing std::optional.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_OPTIONAL_VIEW_HPP
+#define LIBREGLISSE_OPTIONAL_VIEW_HPP
+
+#include <libreglisse/maybe.hpp>
+
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse
+{
+   /**
+    * @brief A reference to a `std::optional` offering the interface of a maybe.
+    *
+    * Nothing is moved or copied when the view is created, the optional is read and modified in
+    * place. The view must not outlive the optional it refers to.
+    *
+    * @code
+    * std::optional<std::string> name = lookup(id);
+    *
+    * optional_view(name).transform(&std::string::size).take_or(0);
+    * @endcode
+    *
+    * @tparam T The type held by the optional, `const` qualified to view a constant optional.
+    * @tparam Check The policy called when the value is accessed on an empty optional.
+    */
+   template <std::destructible T, check_policy Check = default_check>
+      requires(not std::is_reference_v<T>)
+   class optional_view
+   {
+   public:
+      using value_type = std::remove_const_t<T>;
+      using optional_type = std::conditional_t<std::is_const_v<T>, const std::optional<value_type>,
+                                               std::optional<value_type>>;
+      using check_type = Check;
+
+   private:
+      template <class U>
+      using rebind = maybe<U, check_type>;
+
+   public:
+      constexpr optional_view(optional_type& optional) noexcept :
+         m_optional(std::addressof(optional))
+      {}
+
+      [[nodiscard]] constexpr auto is_some() const noexcept -> bool
+      {
+         return m_optional->has_value();
+      }
+      [[nodiscard]] constexpr auto is_none() const noexcept -> bool { return not is_some(); }
+      [[nodiscard]] constexpr explicit operator bool() const noexcept { return is_some(); }
+
+      constexpr auto borrow() const -> T&
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return **m_optional;
+      }
+      constexpr auto take() const -> value_type requires(not std::is_const_v<T>)
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return std::move(**m_optional);
+      }
+      template <std::convertible_to<value_type> U>
+      constexpr auto take_or(U&& or_val) const -> value_type
+      {
+         if (is_some())
+         {
+            if constexpr (std::is_const_v<T>)
+            {
+               return **m_optional;
+            }
+            else
+            {
+               return std::move(**m_optional);
+            }
+         }
+
+         return static_cast<value_type>(std::forward<U>(or_val));
+      }
+
+      /**
+       * @brief Destroy the value of the optional, if any, and construct a new one in place from
+       * `args`.
+       */
+      template <class... Args>
+         requires(not std::is_const_v<T> and std::constructible_from<value_type, Args...>)
+      constexpr auto emplace(Args&&... args) const -> value_type&
+      {
+         return m_optional->emplace(std::forward<Args>(args)...);
+      }
+      constexpr void reset() const requires(not std::is_const_v<T>) { m_optional->reset(); }
+
+      template <std::invocable<T&> Fun>
+      constexpr auto transform(Fun&& some_fun) const
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, T&>>>
+      {
+         if (is_some())
+         {
+            return rebind<std::remove_cvref_t<std::invoke_result_t<Fun, T&>>>(
+               std::in_place, std::invoke(std::forward<Fun>(some_fun), **m_optional));
+         }
+
+         return none;
+      }
+      template <std::invocable<T&> Fun>
+      constexpr auto and_then(Fun&& some_fun) const -> std::invoke_result_t<Fun, T&>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), **m_optional);
+         }
+
+         return none;
+      }
+      template <std::invocable<T&> Fun, std::invocable Def>
+      constexpr auto match(Fun&& some_fun, Def&& none_fun) const
+         -> std::common_type_t<std::invoke_result_t<Fun, T&>, std::invoke_result_t<Def>>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), **m_optional);
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+      /**
+       * @brief Copy the optional into a standalone maybe.
+       */
+      constexpr auto to_maybe() const -> rebind<value_type>
+         requires std::copy_constructible<value_type>
+      {
+         return rebind<value_type>(*m_optional);
+      }
+
+      /**
+       * @brief The optional the view refers to.
+       */
+      [[nodiscard]] constexpr auto get() const noexcept -> optional_type& { return *m_optional; }
+
+   private:
+      optional_type* m_optional;
+   };
+
+   template <class T>
+   optional_view(std::optional<T>&) -> optional_view<T>;
+   template <class T>
+   optional_view(const std::optional<T>&) -> optional_view<const T>;
+} // namespace reglisse
+
+#endif // LIBREGLISSE_OPTIONAL_VIEW_HPP
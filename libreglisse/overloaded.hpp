@@ -0,0 +1,29 @@
+/**
+ * @file overloaded.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the overloaded helper used to build visitors out of lambdas.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_OVERLOADED_HPP
+#define LIBREGLISSE_OVERLOADED_HPP
+
+namespace reglisse
+{
+   /**
+    * @brief Combine multiple callables into a single overload set.
+    *
+    * @tparam Funs The types of the callables to combine.
+    */
+   template <class... Funs>
+   struct overloaded : Funs...
+   {
+      using Funs::operator()...;
+   };
+
+   template <class... Funs>
+   overloaded(Funs...) -> overloaded<Funs...>;
+} // namespace reglisse
+
+#endif // LIBREGLISSE_OVERLOADED_HPP
@@ -0,0 +1,212 @@
+/**
+ * @file reglisse.cppm
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief The `reglisse` named module, exporting the monadic types of the library.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+module;
+
+#include <libreglisse/any_maybe.hpp>
+#include <libreglisse/any_result.hpp>
+#include <libreglisse/boxed.hpp>
+#include <libreglisse/c_abi.hpp>
+#include <libreglisse/check.hpp>
+#include <libreglisse/either.hpp>
+#include <libreglisse/error_union.hpp>
+#include <libreglisse/likelihood.hpp>
+#include <libreglisse/match.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/maybe_tuple.hpp>
+#include <libreglisse/nan_boxed.hpp>
+#include <libreglisse/one_of.hpp>
+#include <libreglisse/optional_view.hpp>
+#include <libreglisse/overloaded.hpp>
+#include <libreglisse/ref.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/shared.hpp>
+#include <libreglisse/try.hpp>
+#include <libreglisse/zip.hpp>
+
+export module reglisse;
+
+/**
+ * The headers are parsed once, when the module interface is compiled, and importers only load the
+ * resulting binary interface. Macros do not cross module boundaries: `default_check` is the one
+ * selected by the flags the interface was compiled with, `LIBREGLISSE_USE_EXCEPTIONS` defined in
+ * an importer has no effect, and the `REGLISSE_MAYBE` family of reglisse.h is not available,
+ * only the structures it declares.
+ *
+ * The `std::swap` overloads of the headers are not exported, `std::swap` falls back to moves and
+ * the `swap` members remain available.
+ *
+ * Exporting the names declared in the global module fragment needs GCC 14, Clang 16 or MSVC 19.34
+ * and CMake 3.28. Elsewhere, the headers are self-contained and may be imported as header units,
+ * for instance `import <libreglisse/maybe.hpp>;`, where the compiler supports them.
+ */
+export namespace reglisse
+{
+   // check.hpp
+
+   using reglisse::assert_check;
+   using reglisse::check_policy;
+   using reglisse::default_check;
+   using reglisse::no_check;
+   using reglisse::terminate_check;
+   using reglisse::throw_check;
+
+#if defined(__cpp_exceptions)
+   using reglisse::invalid_access_exception;
+#endif // defined(__cpp_exceptions)
+
+   // likelihood.hpp
+
+   using reglisse::expected_outcome;
+   using reglisse::expected_outcome_v;
+   using reglisse::failure_is_likely;
+   using reglisse::outcome_constant;
+   using reglisse::outcome_likelihood;
+   using reglisse::success_is_likely;
+
+   // relocate.hpp
+
+   using reglisse::is_trivially_relocatable;
+   using reglisse::is_trivially_relocatable_v;
+   using reglisse::relocate;
+
+   // maybe.hpp
+
+   using reglisse::make_maybe;
+   using reglisse::maybe;
+   using reglisse::none;
+   using reglisse::none_t;
+   using reglisse::some;
+
+   // result.hpp
+
+   using reglisse::err;
+   using reglisse::in_place_err;
+   using reglisse::in_place_err_t;
+   using reglisse::in_place_ok;
+   using reglisse::in_place_ok_t;
+   using reglisse::make_err;
+   using reglisse::make_ok;
+   using reglisse::ok;
+   using reglisse::result;
+
+   // error_union.hpp
+
+   using reglisse::basic_error_union;
+   using reglisse::error_union;
+
+   // either.hpp
+
+   using reglisse::either;
+   using reglisse::in_place_left;
+   using reglisse::in_place_left_t;
+   using reglisse::in_place_right;
+   using reglisse::in_place_right_t;
+   using reglisse::left;
+   using reglisse::make_left;
+   using reglisse::make_right;
+   using reglisse::right;
+
+   // match.hpp and overloaded.hpp
+
+   using reglisse::match;
+   using reglisse::overloaded;
+
+   // zip.hpp
+
+   using reglisse::lift;
+   using reglisse::zip;
+
+   // try.hpp
+
+   using reglisse::try_wrap;
+
+   // ref.hpp
+
+   using reglisse::const_ref;
+   using reglisse::mut_ref;
+   using reglisse::ref;
+
+   // one_of.hpp
+
+   using reglisse::alternative;
+   using reglisse::at;
+   using reglisse::basic_one_of;
+   using reglisse::one_of;
+
+   // boxed.hpp
+
+   using reglisse::allocate_boxed;
+   using reglisse::boxed;
+   using reglisse::make_boxed;
+   using reglisse::maybe_box;
+   using reglisse::result_box;
+
+   // shared.hpp
+
+   using reglisse::atomic_refcount;
+   using reglisse::local_refcount;
+   using reglisse::make_shared_value;
+   using reglisse::shared;
+   using reglisse::shared_maybe;
+   using reglisse::shared_result;
+
+   // maybe_tuple.hpp
+
+   using reglisse::basic_maybe_tuple;
+   using reglisse::maybe_field;
+   using reglisse::maybe_tuple;
+
+   // nan_boxed.hpp
+
+   using reglisse::nan_boxed_either;
+   using reglisse::nan_boxed_result;
+
+   // any_maybe.hpp and any_result.hpp
+
+   using reglisse::any_maybe;
+   using reglisse::any_result;
+   using reglisse::basic_any_maybe;
+   using reglisse::basic_any_result;
+
+   // optional_view.hpp
+
+   using reglisse::optional_view;
+
+   // c_abi.hpp
+
+   using reglisse::c_abi_type;
+   using reglisse::c_abi_type_t;
+   using reglisse::c_layout_of;
+   using reglisse::from_c;
+   using reglisse::to_c;
+
+   // The comparisons of every type above.
+
+   using reglisse::operator==;
+   using reglisse::operator<=>;
+} // namespace reglisse
+
+/**
+ * The C structures of reglisse.h, used with `to_c` and `from_c`.
+ */
+export
+{
+   using ::reglisse_maybe_f64;
+   using ::reglisse_maybe_i32;
+   using ::reglisse_maybe_i64;
+   using ::reglisse_maybe_ptr;
+   using ::reglisse_maybe_u32;
+   using ::reglisse_maybe_u64;
+   using ::reglisse_result_f64_i32;
+   using ::reglisse_result_i32_i32;
+   using ::reglisse_result_i64_i32;
+   using ::reglisse_result_ptr_i32;
+   using ::reglisse_result_u64_i32;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file reglisse.h
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief C declarations sharing the layout of maybe and result, for trivially copyable payloads.
+ * @copyright Copyright (C) 2021 wmbat.
+ *
+ * The structures declared here have the layout of the C++ types they mirror, which are converted
+ * to and from them by value with `to_c` and `from_c`, see `libreglisse/c_abi.hpp` on the C++ side.
+ * Requires C11 for anonymous unions.
+ *
+ * `maybe<T>`:
+ *    - `is_none`: true when the maybe is empty. Note that a zeroed structure holds a value.
+ *    - `value`: the held value, indeterminate when `is_none` is true.
+ *
+ * `result<V, E>`, when `V` and `E` differ:
+ *    - `is_ok`: true when the result holds a value.
+ *    - `value`: the held value, valid when `is_ok` is true.
+ *    - `error`: the held error, valid when `is_ok` is false.
+ *
+ * `result<T, T>`, where the value and the error share their storage:
+ *    - `payload`: the held value or error.
+ *    - `is_ok`: true when `payload` is a value.
+ */
+
+#ifndef LIBREGLISSE_REGLISSE_H
+#define LIBREGLISSE_REGLISSE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Declare `name`, a structure with the layout of `reglisse::maybe<T>`.
+ */
+#define REGLISSE_MAYBE(name, T)                                                                    \
+   typedef struct name                                                                             \
+   {                                                                                               \
+      bool is_none;                                                                                \
+      T value;                                                                                     \
+   } name
+
+/**
+ * @brief Declare `name`, a structure with the layout of `reglisse::result<V, E>`, where `V` and
+ * `E` are different types.
+ */
+#define REGLISSE_RESULT(name, V, E)                                                                \
+   typedef struct name                                                                             \
+   {                                                                                               \
+      bool is_ok;                                                                                  \
+      union                                                                                        \
+      {                                                                                            \
+         V value;                                                                                  \
+         E error;                                                                                  \
+      };                                                                                           \
+   } name
+
+/**
+ * @brief Declare `name`, a structure with the layout of `reglisse::result<T, T>`.
+ */
+#define REGLISSE_RESULT_SAME(name, T)                                                              \
+   typedef struct name                                                                             \
+   {                                                                                               \
+      T payload;                                                                                   \
+      bool is_ok;                                                                                  \
+   } name
+
+REGLISSE_MAYBE(reglisse_maybe_i32, int32_t);
+REGLISSE_MAYBE(reglisse_maybe_i64, int64_t);
+REGLISSE_MAYBE(reglisse_maybe_u32, uint32_t);
+REGLISSE_MAYBE(reglisse_maybe_u64, uint64_t);
+REGLISSE_MAYBE(reglisse_maybe_f64, double);
+REGLISSE_MAYBE(reglisse_maybe_ptr, void*);
+
+REGLISSE_RESULT_SAME(reglisse_result_i32_i32, int32_t);
+REGLISSE_RESULT(reglisse_result_i64_i32, int64_t, int32_t);
+REGLISSE_RESULT(reglisse_result_u64_i32, uint64_t, int32_t);
+REGLISSE_RESULT(reglisse_result_f64_i32, double, int32_t);
+REGLISSE_RESULT(reglisse_result_ptr_i32, void*, int32_t);
+
+#endif /* LIBREGLISSE_REGLISSE_H */
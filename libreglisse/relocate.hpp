@@ -0,0 +1,87 @@
+/**
+ * @file relocate.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the is_trivially_relocatable trait and the relocate algorithm.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_RELOCATE_HPP
+#define LIBREGLISSE_RELOCATE_HPP
+
+#include <concepts>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace reglisse
+{
+   /**
+    * @brief Whether moving a `T` to a new address and destroying the source can be done by
+    * copying its bytes.
+    *
+    * Every trivially copyable type is trivially relocatable. Other types may opt in by
+    * specializing the trait, the monadic types of the library do so whenever their payloads are
+    * trivially relocatable.
+    *
+    * @tparam T The type to check.
+    */
+   template <class T>
+   struct is_trivially_relocatable : std::is_trivially_copyable<T>
+   {
+   };
+
+   template <class T>
+   inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+   /**
+    * @brief A unique_ptr using the default deleter only holds a pointer.
+    */
+   template <class T>
+   struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+   {
+   };
+
+   /**
+    * @brief Move the objects in `[first, last)` to the uninitialized storage starting at
+    * `d_first` and destroy the originals.
+    *
+    * Trivially relocatable objects are copied bytewise in a single `memcpy`, other objects are
+    * moved and destroyed one by one. The ranges must not overlap.
+    *
+    * @param first The beginning of the range of objects to relocate.
+    * @param last The end of the range of objects to relocate.
+    * @param d_first The beginning of the destination storage.
+    *
+    * @return A pointer past the last relocated object in the destination storage.
+    */
+   template <std::move_constructible T>
+   constexpr auto relocate(T* first, T* last, T* d_first) -> T*
+   {
+      if constexpr (is_trivially_relocatable_v<T>)
+      {
+         if (not std::is_constant_evaluated())
+         {
+            const auto count = static_cast<std::size_t>(last - first);
+
+            if (count != 0)
+            {
+               std::memcpy(static_cast<void*>(d_first), static_cast<const void*>(first),
+                           count * sizeof(T));
+            }
+
+            return d_first + count;
+         }
+      }
+
+      for (; first != last; ++first, ++d_first)
+      {
+         std::construct_at(d_first, std::move(*first));
+         std::destroy_at(first);
+      }
+
+      return d_first;
+   }
+} // namespace reglisse
+
+#endif // LIBREGLISSE_RELOCATE_HPP
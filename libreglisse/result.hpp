@@ -8,65 +8,115 @@
 
 #pragma once
 
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-#   include <libreglisse/detail/invalid_access_exception.hpp>
-#else
-#   include <cassert>
-#endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
-
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/binary_storage.hpp>
+#include <libreglisse/detail/from_invoke.hpp>
+#include <libreglisse/detail/widen_error.hpp>
+#include <libreglisse/likelihood.hpp>
+#include <libreglisse/relocate.hpp>
+
+#include <concepts>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_expected)
+#   include <expected>
+#endif // defined(__cpp_lib_expected)
 
 namespace reglisse::detail
 {
-   inline void handle_invalid_value_result_access(bool check)
+   struct zip_access;
+
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_value_result_access(bool check)
    {
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-      if (!check)
-      {
-         throw invalid_access_exception("result currently holds an error");
-      }
-#else
-      assert(check && "result currently holds an error"); // NOLINT
-#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+      Check::check(check, "result currently holds an error");
    }
 
-   inline void handle_invalid_error_result_access(bool check)
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_error_result_access(bool check)
    {
-#if defined(LIBREGLISSE_USE_EXCEPTIONS)
-      if (!check)
-      {
-         throw invalid_access_exception("result currently holds an value");
-      }
-#else
-      assert(check && "result currently holds a value");  // NOLINT
-#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+      Check::check(check, "result currently holds a value");
    }
 
    template <typename Fun, typename T>
    concept ensure_result = std::invocable<Fun, T> and requires
    {
-      {std::invoke_result_t<Fun, T>::value_type};
-      {std::invoke_result_t<Fun, T>::error_type};
+      typename std::invoke_result_t<Fun, T>::value_type;
+      typename std::invoke_result_t<Fun, T>::error_type;
    };
 
+   /**
+    * @brief Ensure that `Fun` returns a result when called with `ValueType`. The error type of
+    * that result may differ from `ErrorType`, see `widen_error_t`.
+    */
    template <typename Fun, typename ValueType, typename ErrorType>
    concept ensure_value_result = ensure_result<Fun, ValueType> and
-      std::same_as<typename std::invoke_result_t<Fun, ValueType>::error_type, ErrorType>;
+      std::constructible_from<
+         widen_error_t<ErrorType, typename std::invoke_result_t<Fun, ValueType>::error_type>,
+         ErrorType>;
 
    template <typename Fun, typename ValueType, typename ErrorType>
    concept ensure_error_result = ensure_result<Fun, ErrorType> and
       std::same_as<typename std::invoke_result_t<Fun, ErrorType>::value_type, ValueType>;
 
+   /**
+    * @brief Ensure that `Fun` can map `ErrorType`, either directly or by visiting every error
+    * held by an error_union.
+    */
+   template <typename Fun, typename ErrorType>
+   concept ensure_error_mapper = std::invocable<Fun, ErrorType> or
+      (is_error_union<std::remove_cvref_t<ErrorType>> and requires(Fun&& fun, ErrorType&& error) {
+         std::forward<ErrorType>(error).visit(std::forward<Fun>(fun));
+      });
+
+   template <typename Fun, typename ErrorType>
+   constexpr auto map_error(Fun&& fun, ErrorType&& error) -> decltype(auto)
+   {
+      if constexpr (std::invocable<Fun, ErrorType>)
+      {
+         return std::invoke(std::forward<Fun>(fun), std::forward<ErrorType>(error));
+      }
+      else
+      {
+         return std::forward<ErrorType>(error).visit(std::forward<Fun>(fun));
+      }
+   }
+
+   template <typename Fun, typename ErrorType>
+   using map_error_result_t =
+      std::remove_cvref_t<decltype(map_error(std::declval<Fun>(), std::declval<ErrorType>()))>;
 } // namespace reglisse::detail
 
 namespace reglisse
 {
-   template <std::movable T>
+   /**
+    * @brief Tag used to construct the value of a result in place.
+    */
+   struct in_place_ok_t
+   {
+      explicit in_place_ok_t() = default;
+   };
+
+   inline constexpr auto in_place_ok = in_place_ok_t();
+
+   /**
+    * @brief Tag used to construct the error of a result in place.
+    */
+   struct in_place_err_t
+   {
+      explicit in_place_err_t() = default;
+   };
+
+   inline constexpr auto in_place_err = in_place_err_t();
+
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class ok;
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class err
    {
@@ -97,7 +147,7 @@ namespace reglisse
       value_type m_value;
    };
 
-   template <std::movable T>
+   template <std::destructible T>
       requires(not std::is_reference_v<T>)
    class ok
    {
@@ -128,145 +178,172 @@ namespace reglisse
       value_type m_value;
    };
 
-   template <std::movable ValueType, std::movable ErrorType>
+   /**
+    * @brief Holds either a value or an error.
+    *
+    * @tparam ValueType The type of the value.
+    * @tparam ErrorType The type of the error.
+    * @tparam Check The policy called when the value or the error is accessed on the wrong side.
+    */
+   template <std::destructible ValueType, std::destructible ErrorType,
+             check_policy Check = default_check>
       requires(not(std::is_reference_v<ValueType> or std::is_reference_v<ErrorType>))
    class result
    {
+      template <std::destructible OtherValue, std::destructible OtherError,
+                check_policy OtherCheck>
+         requires(not(std::is_reference_v<OtherValue> or std::is_reference_v<OtherError>))
+      friend class result;
+
+      friend struct detail::c_layout;
+      friend struct detail::zip_access;
+
    public:
       using value_type = ValueType;
       using error_type = ErrorType;
+      using check_type = Check;
 
    private:
+      template <class OtherValue, class OtherError>
+      using rebind = result<OtherValue, OtherError, check_type>;
+
+      using storage_type = detail::binary_storage<value_type, error_type>;
+
       template <class value_fun, class error_fun>
       using join_result = std::common_type_t<std::invoke_result_t<value_fun, value_type>,
                                              std::invoke_result_t<error_fun, error_type>>;
 
+      template <class Fun, class Value = value_type>
+      using and_then_result =
+         result<typename std::invoke_result_t<Fun, Value>::value_type,
+                detail::widen_error_t<error_type,
+                                      typename std::invoke_result_t<Fun, Value>::error_type>,
+                typename std::invoke_result_t<Fun, Value>::check_type>;
+
    public:
       constexpr result() = delete;
-      constexpr result(ok<value_type>&& value) : m_is_ok(true)
-      {
-         std::construct_at(&m_value, std::move(value).value()); // NOLINT
+      constexpr result(ok<value_type>&& value) :
+         m_storage(std::in_place_index<0>, std::move(value).value())
+      {}
+      constexpr result(err<error_type>&& error) :
+         m_storage(std::in_place_index<1>, std::move(error).value())
+      {}
+      /**
+       * @brief Create a result holding a value constructed in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr explicit result(in_place_ok_t, Args&&... args) :
+         m_storage(std::in_place_index<0>, std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create a result holding an error constructed in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the error.
+       */
+      template <class... Args>
+         requires std::constructible_from<error_type, Args...>
+      constexpr explicit result(in_place_err_t, Args&&... args) :
+         m_storage(std::in_place_index<1>, std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create a result by widening the error type of `other`.
+       */
+      template <class OtherError>
+         requires(not std::same_as<OtherError, error_type> and
+                  std::constructible_from<error_type, OtherError&&>)
+      constexpr explicit(not std::convertible_to<OtherError&&, error_type>)
+         result(rebind<value_type, OtherError>&& other) :
+         m_storage(std::move(other.m_storage))
+      {}
+#if defined(__cpp_lib_expected)
+      /**
+       * @brief Create a result from a `std::expected`, moving its value or error exactly once.
+       */
+      constexpr result(std::expected<value_type, error_type>&& other) :
+         m_storage(other.has_value() ? storage_type(std::in_place_index<0>, std::move(*other))
+                                     : storage_type(std::in_place_index<1>,
+                                                    std::move(other).error()))
+      {}
+      constexpr result(const std::expected<value_type, error_type>& other) requires(
+         std::copy_constructible<value_type> and std::copy_constructible<error_type>) :
+         m_storage(other.has_value() ? storage_type(std::in_place_index<0>, *other)
+                                     : storage_type(std::in_place_index<1>, other.error()))
+      {}
+#endif // defined(__cpp_lib_expected)
+      constexpr result(const result&) requires(
+         std::copy_constructible<value_type> and std::copy_constructible<error_type>) = default;
+      constexpr result(result&&) requires(
+         std::move_constructible<value_type> and std::move_constructible<error_type>) = default;
+      constexpr ~result() = default;
+
+      constexpr auto operator=(const result&) -> result& requires(
+         std::copy_constructible<value_type> and std::copy_constructible<error_type>) = default;
+      constexpr auto operator=(result&&) -> result& requires(
+         std::move_constructible<value_type> and std::move_constructible<error_type>) = default;
+
+      constexpr void swap(result& other) requires(
+         std::swappable<value_type> and std::swappable<error_type>)
+      {
+         std::swap(m_storage, other.m_storage);
       }
-      constexpr result(err<error_type>&& error) : m_is_ok(false)
+
+      constexpr auto borrow() const& -> const value_type&
       {
-         std::construct_at(&m_error, std::move(error).value()); // NOLINT
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+         return m_storage.first();
       }
-      constexpr result(const result& other) : m_is_ok(other.m_is_ok)
+      constexpr auto borrow() & -> value_type&
       {
-         if (is_ok())
-         {
-            std::construct_at(&m_value, other.borrow()); // NOLINT
-         }
-         else
-         {
-            std::construct_at(&m_error, other.borrow_err()); // NOLINT
-         }
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+         return m_storage.first();
       }
-      constexpr result(result&& other) noexcept : m_is_ok(other.m_is_ok)
+      constexpr auto take() const&& -> value_type
       {
-         if (is_ok())
-         {
-            std::construct_at(&m_value, std::move(other).take()); // NOLINT
-         }
-         else
-         {
-            std::construct_at(&m_error, std::move(other).take_err()); // NOLINT
-         }
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+         return std::move(m_storage.first());
       }
-      constexpr ~result()
+      constexpr auto take() && -> value_type
       {
-         if (is_ok())
-         {
-            std::destroy_at(&m_value); // NOLINT
-         }
-         else
-         {
-            std::destroy_at(&m_error); // NOLINT
-         }
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+         return std::move(m_storage.first());
       }
 
-      constexpr auto operator=(const result& rhs) -> result&
+#if defined(__cpp_lib_expected)
+      /**
+       * @brief Move the held value or error into a `std::expected`, exactly once.
+       */
+      constexpr auto to_expected() && -> std::expected<value_type, error_type>
       {
-         if (this != &rhs)
+         if (is_ok())
          {
-            if (is_ok())
-            {
-               std::destroy_at(&m_value); // NOLINT
-            }
-            else
-            {
-               std::destroy_at(&m_error); // NOLINT
-            }
-
-            m_is_ok = rhs.m_is_ok;
-
-            if (is_ok())
-            {
-               std::construct_at(&m_value, rhs.borrow()); // NOLINT
-            }
-            else
-            {
-               std::construct_at(&m_error, rhs.borrow_err()); // NOLINT
-            }
+            return std::expected<value_type, error_type>(std::in_place,
+                                                         std::move(m_storage.first()));
          }
 
-         return *this;
+         return std::expected<value_type, error_type>(std::unexpect,
+                                                      std::move(m_storage.second()));
       }
-      constexpr auto operator=(result&& rhs) noexcept -> result&
+      constexpr auto to_expected() const& -> std::expected<value_type, error_type>
+         requires(std::copy_constructible<value_type> and std::copy_constructible<error_type>)
       {
-         if (this != &rhs)
+         if (is_ok())
          {
-            if (is_ok())
-            {
-               std::destroy_at(&m_value); // NOLINT
-            }
-            else
-            {
-               std::destroy_at(&m_error); // NOLINT
-            }
-
-            m_is_ok = rhs.m_is_ok;
-
-            if (is_ok())
-            {
-               std::construct_at(&m_value, std::move(rhs).take()); // NOLINT
-            }
-            else
-            {
-               std::construct_at(&m_error, std::move(rhs).take_err()); // NOLINT
-            }
+            return std::expected<value_type, error_type>(std::in_place, m_storage.first());
          }
 
-         return *this;
-      }
-
-      constexpr auto borrow() const& -> const value_type&
-      {
-         detail::handle_invalid_value_result_access(is_ok());
-         return m_value;
-      }
-      constexpr auto borrow() & -> value_type&
-      {
-         detail::handle_invalid_value_result_access(is_ok());
-         return m_value;
-      }
-      constexpr auto take() const&& -> value_type
-      {
-         detail::handle_invalid_value_result_access(is_ok());
-         return std::move(m_value);
-      }
-      constexpr auto take() && -> value_type
-      {
-         detail::handle_invalid_value_result_access(is_ok());
-         return std::move(m_value);
+         return std::expected<value_type, error_type>(std::unexpect, m_storage.second());
       }
+#endif // defined(__cpp_lib_expected)
 
       template <std::convertible_to<value_type> U>
       constexpr auto take_or(U&& other) const&& -> value_type
       {
-         if (is_ok())
+         if (expect_ok())
          {
-            return std::move(m_value);
+            return std::move(m_storage.first());
          }
 
          return std::forward<U>(other);
@@ -274,9 +351,9 @@ namespace reglisse
       template <std::convertible_to<value_type> U>
       constexpr auto take_or(U&& other) && -> value_type
       {
-         if (is_ok())
+         if (expect_ok())
          {
-            return std::move(m_value);
+            return std::move(m_storage.first());
          }
 
          return std::forward<U>(other);
@@ -284,171 +361,577 @@ namespace reglisse
 
       constexpr auto borrow_err() const& -> const error_type&
       {
-         detail::handle_invalid_value_result_access(is_err());
-         return m_error;
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+         return m_storage.second();
       }
       constexpr auto borrow_err() & -> error_type&
       {
-         detail::handle_invalid_value_result_access(is_err());
-         return m_error;
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+         return m_storage.second();
       }
       constexpr auto take_err() const&& -> error_type
       {
-         detail::handle_invalid_value_result_access(is_err());
-         return std::move(m_error);
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+         return std::move(m_storage.second());
       }
       constexpr auto take_err() && -> error_type
       {
-         detail::handle_invalid_value_result_access(is_err());
-         return std::move(m_error);
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+         return std::move(m_storage.second());
       }
 
-      template <std::convertible_to<value_type> U>
+      template <std::convertible_to<error_type> U>
       constexpr auto take_err_or(U&& other) const&& -> error_type
       {
-         if (is_ok())
+         if (not expect_ok())
          {
-            return std::move(m_value);
+            return std::move(m_storage.second());
          }
 
          return std::forward<U>(other);
       }
-      template <std::convertible_to<value_type> U>
+      template <std::convertible_to<error_type> U>
       constexpr auto take_err_or(U&& other) && -> error_type
       {
-         if (is_err())
+         if (not expect_ok())
          {
-            return std::move(m_error);
+            return std::move(m_storage.second());
          }
 
          return std::forward<U>(other);
       }
 
-      constexpr auto is_ok() const noexcept -> bool { return m_is_ok; }
+      /**
+       * @brief Destroy the held value or error and construct a new value in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the value.
+       *
+       * @return A reference to the newly constructed value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      constexpr auto emplace(Args&&... args) -> value_type&
+      {
+         return m_storage.emplace_first(std::forward<Args>(args)...);
+      }
+      /**
+       * @brief Destroy the held value or error and construct a new error in place from `args`.
+       *
+       * @param args The arguments forwarded to the constructor of the error.
+       *
+       * @return A reference to the newly constructed error.
+       */
+      template <class... Args>
+         requires std::constructible_from<error_type, Args...>
+      constexpr auto emplace_err(Args&&... args) -> error_type&
+      {
+         return m_storage.emplace_second(std::forward<Args>(args)...);
+      }
+
+      constexpr auto is_ok() const noexcept -> bool { return m_storage.is_first(); }
       constexpr auto is_err() const noexcept -> bool { return not is_ok(); }
       constexpr explicit operator bool() const noexcept { return is_ok(); }
 
       template <std::invocable<value_type> Fun>
       constexpr auto
-      transform(Fun&& fun) const&& -> result<std::invoke_result_t<Fun, value_type&&>, error_type>
+      transform(Fun&& fun) const&& -> rebind<std::invoke_result_t<Fun, value_type&&>, error_type>
       {
-         if (is_ok())
+         using ret = rebind<std::invoke_result_t<Fun, value_type&&>, error_type>;
+
+         if (expect_ok())
          {
-            return ok(std::invoke(std::forward<Fun>(fun), take()));
+            return ret(detail::from_invoke, in_place_ok, std::forward<Fun>(fun),
+                       std::move(m_storage.first()));
          }
 
-         return err(take_err());
+         return ret(in_place_err, std::move(m_storage.second()));
       }
       template <std::invocable<value_type> Fun>
       constexpr auto
-      transform(Fun&& fun) && -> result<std::invoke_result_t<Fun, value_type&&>, error_type>
+      transform(Fun&& fun) && -> rebind<std::invoke_result_t<Fun, value_type&&>, error_type>
       {
-         if (is_ok())
+         using ret = rebind<std::invoke_result_t<Fun, value_type&&>, error_type>;
+
+         if (expect_ok())
          {
-            return ok(std::invoke(std::forward<Fun>(fun), take()));
+            return ret(detail::from_invoke, in_place_ok, std::forward<Fun>(fun),
+                       std::move(m_storage.first()));
          }
 
-         return err(take_err());
+         return ret(in_place_err, std::move(m_storage.second()));
       }
+      /**
+       * @brief Transform the held value without consuming the result.
+       *
+       * The value is passed by reference, only the result of `fun` and a copy of the error, if
+       * any, are stored in the returned result.
+       */
+      template <std::invocable<value_type&> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto transform(Fun&& fun) &
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, value_type&>>, error_type>;
 
-      template <std::invocable<value_type> Fun>
+         if (expect_ok())
+         {
+            return ret(detail::from_invoke, in_place_ok, std::forward<Fun>(fun), m_storage.first());
+         }
+
+         return ret(in_place_err, m_storage.second());
+      }
+      template <std::invocable<const value_type&> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto transform(Fun&& fun) const&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>;
+
+         if (expect_ok())
+         {
+            return ret(detail::from_invoke, in_place_ok, std::forward<Fun>(fun), m_storage.first());
+         }
+
+         return ret(in_place_err, m_storage.second());
+      }
+
+      template <detail::ensure_error_mapper<error_type> Fun>
       constexpr auto transform_err(
-         Fun&& err_fun) const&& -> result<value_type, std::invoke_result_t<Fun, error_type>>
+         Fun&& err_fun) const&& -> rebind<value_type, detail::map_error_result_t<Fun, error_type>>
       {
-         if (is_err())
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, error_type>>;
+
+         if (not expect_ok())
          {
-            return err(std::invoke(std::forward<Fun>(err_fun), take_err()));
+            return ret(detail::from_invoke, in_place_err, [&] {
+               return detail::map_error(std::forward<Fun>(err_fun), std::move(m_storage.second()));
+            });
          }
 
-         return ok(take());
+         return ret(in_place_ok, std::move(m_storage.first()));
       }
+      template <detail::ensure_error_mapper<error_type> Fun>
+      constexpr auto transform_err(
+         Fun&& err_fun) && -> rebind<value_type, detail::map_error_result_t<Fun, error_type>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, error_type>>;
 
-      template <std::invocable<error_type> Fun>
-      constexpr auto
-      transform_err(Fun&& err_fun) && -> result<value_type, std::invoke_result_t<Fun, error_type>>
+         if (not expect_ok())
+         {
+            return ret(detail::from_invoke, in_place_err, [&] {
+               return detail::map_error(std::forward<Fun>(err_fun), std::move(m_storage.second()));
+            });
+         }
+
+         return ret(in_place_ok, std::move(m_storage.first()));
+      }
+      template <detail::ensure_error_mapper<error_type&> Fun>
+         requires std::copy_constructible<value_type>
+      constexpr auto transform_err(Fun&& err_fun) &
+         -> rebind<value_type, detail::map_error_result_t<Fun, error_type&>>
       {
-         if (is_err())
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, error_type&>>;
+
+         if (not expect_ok())
          {
-            return err(std::invoke(std::forward<Fun>(err_fun), take_err()));
+            return ret(detail::from_invoke, in_place_err, [&] {
+               return detail::map_error(std::forward<Fun>(err_fun), m_storage.second());
+            });
          }
 
-         return ok(take());
+         return ret(in_place_ok, m_storage.first());
+      }
+      template <detail::ensure_error_mapper<const error_type&> Fun>
+         requires std::copy_constructible<value_type>
+      constexpr auto transform_err(Fun&& err_fun) const&
+         -> rebind<value_type, detail::map_error_result_t<Fun, const error_type&>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, const error_type&>>;
+
+         if (not expect_ok())
+         {
+            return ret(detail::from_invoke, in_place_err, [&] {
+               return detail::map_error(std::forward<Fun>(err_fun), m_storage.second());
+            });
+         }
+
+         return ret(in_place_ok, m_storage.first());
       }
 
       template <detail::ensure_value_result<value_type, error_type> Fun>
-      constexpr auto and_then(Fun&& some_fun) const&& -> std::invoke_result_t<Fun, value_type>
+      constexpr auto and_then(Fun&& some_fun) const&& -> and_then_result<Fun>
       {
-         if (is_ok())
+         if (expect_ok())
          {
-            return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
+            return std::invoke(std::forward<Fun>(some_fun), std::move(m_storage.first()));
          }
 
-         return err(take_err());
+         return err(typename and_then_result<Fun>::error_type(m_storage.second()));
       }
       template <detail::ensure_value_result<value_type, error_type> Fun>
-      constexpr auto and_then(Fun&& some_fun) && -> std::invoke_result_t<Fun, value_type>
+      constexpr auto and_then(Fun&& some_fun) && -> and_then_result<Fun>
       {
-         if (is_ok())
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), std::move(m_storage.first()));
+         }
+
+         return err(typename and_then_result<Fun>::error_type(std::move(m_storage.second())));
+      }
+      template <detail::ensure_value_result<value_type&, error_type> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto and_then(Fun&& some_fun) & -> and_then_result<Fun, value_type&>
+      {
+         if (expect_ok())
          {
-            return std::invoke(std::forward<Fun>(some_fun), std::move(m_value)); // NOLINT
+            return std::invoke(std::forward<Fun>(some_fun), m_storage.first());
          }
 
-         return err(take_err());
+         using error = typename and_then_result<Fun, value_type&>::error_type;
+
+         return err(error(m_storage.second()));
+      }
+      template <detail::ensure_value_result<const value_type&, error_type> Fun>
+         requires std::copy_constructible<error_type>
+      constexpr auto and_then(Fun&& some_fun) const& -> and_then_result<Fun, const value_type&>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), m_storage.first());
+         }
+
+         using error = typename and_then_result<Fun, const value_type&>::error_type;
+
+         return err(error(m_storage.second()));
       }
 
       template <detail::ensure_error_result<value_type, error_type> Fun>
       constexpr auto or_else(Fun&& none_fun) const&& -> std::invoke_result_t<Fun, error_type>
       {
-         if (is_ok())
+         if (expect_ok())
          {
-            return ok(take());
+            return ok(value_type(m_storage.first()));
          }
 
-         return std::invoke(std::forward<Fun>(none_fun), take_err());
+         return std::invoke(std::forward<Fun>(none_fun), error_type(m_storage.second()));
       }
       template <detail::ensure_error_result<value_type, error_type> Fun>
       constexpr auto or_else(Fun&& none_fun) && -> std::invoke_result_t<Fun, error_type>
       {
-         if (is_ok())
+         if (expect_ok())
          {
-            return ok(take());
+            return ok(std::move(m_storage.first()));
          }
 
-         return std::invoke(std::forward<Fun>(none_fun), take_err());
+         return std::invoke(std::forward<Fun>(none_fun), std::move(m_storage.second()));
       }
+      template <detail::ensure_error_result<value_type, error_type&> Fun>
+         requires std::copy_constructible<value_type>
+      constexpr auto or_else(Fun&& none_fun) & -> std::invoke_result_t<Fun, error_type&>
+      {
+         if (expect_ok())
+         {
+            return ok(value_type(m_storage.first()));
+         }
 
+         return std::invoke(std::forward<Fun>(none_fun), m_storage.second());
+      }
+      template <detail::ensure_error_result<value_type, const error_type&> Fun>
+         requires std::copy_constructible<value_type>
+      constexpr auto or_else(Fun&& none_fun) const& -> std::invoke_result_t<Fun, const error_type&>
+      {
+         if (expect_ok())
+         {
+            return ok(value_type(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(none_fun), m_storage.second());
+      }
+
+      /**
+       * @brief Move out the value or the error, whichever is held.
+       *
+       * When `value_type` and `error_type` are the same, both share the same storage and the
+       * state of the result is not tested.
+       */
       template <class inner_value_ = value_type, class inner_error_ = error_type>
       constexpr auto join() const&& -> std::common_type_t<inner_value_, inner_error_>
       {
-         return is_ok() ? take() : take_err();
+         if constexpr (std::same_as<value_type, error_type>)
+         {
+            return std::move(m_storage.first());
+         }
+         else
+         {
+            if (expect_ok())
+            {
+               return std::move(m_storage.first());
+            }
+
+            return std::move(m_storage.second());
+         }
       }
       template <class inner_value_ = value_type, class inner_error_ = error_type>
       constexpr auto join() && -> std::common_type_t<inner_value_, inner_error_>
       {
-         return is_ok() ? take() : take_err();
+         if constexpr (std::same_as<value_type, error_type>)
+         {
+            return std::move(m_storage.first());
+         }
+         else
+         {
+            if (expect_ok())
+            {
+               return std::move(m_storage.first());
+            }
+
+            return std::move(m_storage.second());
+         }
       }
 
       template <std::invocable<value_type> OkFun, std::invocable<error_type> ErrFun>
       constexpr auto join(OkFun&& ok_fun, ErrFun&& err_fun) const&& -> join_result<OkFun, ErrFun>
       {
-         return is_ok() ? std::invoke(std::forward<OkFun>(ok_fun), take())
-                        : std::invoke(std::forward<ErrFun>(err_fun), take_err());
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value_type(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), error_type(m_storage.second()));
       }
 
       template <std::invocable<value_type> OkFun, std::invocable<error_type> ErrFun>
       constexpr auto join(OkFun&& ok_fun, ErrFun&& err_fun) && -> join_result<OkFun, ErrFun>
       {
-         return is_ok() ? std::invoke(std::forward<OkFun>(ok_fun), take())
-                        : std::invoke(std::forward<ErrFun>(err_fun), take_err());
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), std::move(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), std::move(m_storage.second()));
+      }
+
+      /**
+       * @brief Call `fun` with either the held value or the held error.
+       *
+       * The state of the result is only tested once and the value or error is passed by
+       * reference, following the value category of the result. Use the two callables overload
+       * when `value_type` and `error_type` are the same.
+       *
+       * @param fun A callable, usually an `overloaded` set, invocable with both the value and the
+       * error.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&> and std::invocable<Fun, error_type&> and
+                  not std::same_as<value_type, error_type>)
+      constexpr auto match(Fun&& fun) &
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&>,
+                               std::invoke_result_t<Fun, error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
+      }
+      template <class Fun>
+         requires(std::invocable<Fun, const value_type&> and
+                  std::invocable<Fun, const error_type&> and
+                  not std::same_as<value_type, error_type>)
+      constexpr auto match(Fun&& fun) const&
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>,
+                               std::invoke_result_t<Fun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
       }
+      template <class Fun>
+         requires(std::invocable<Fun, value_type&&> and std::invocable<Fun, error_type&&> and
+                  not std::same_as<value_type, error_type>)
+      constexpr auto match(Fun&& fun) &&
+         -> std::common_type_t<std::invoke_result_t<Fun, value_type&&>,
+                               std::invoke_result_t<Fun, error_type&&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), std::move(m_storage.first()));
+         }
 
-   private:
-      bool m_is_ok;
+         return std::invoke(std::forward<Fun>(fun), std::move(m_storage.second()));
+      }
+
+      /**
+       * @brief Call `ok_fun` with the held value, or `err_fun` with the held error.
+       *
+       * The state of the result is only tested once and the value or error is passed by
+       * reference, following the value category of the result.
+       */
+      template <std::invocable<value_type&> OkFun, std::invocable<error_type&> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) &
+         -> std::common_type_t<std::invoke_result_t<OkFun, value_type&>,
+                               std::invoke_result_t<ErrFun, error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), m_storage.first());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+      template <std::invocable<const value_type&> OkFun,
+                std::invocable<const error_type&> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) const&
+         -> std::common_type_t<std::invoke_result_t<OkFun, const value_type&>,
+                               std::invoke_result_t<ErrFun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), m_storage.first());
+         }
 
-      union
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+      template <std::invocable<value_type&&> OkFun, std::invocable<error_type&&> ErrFun>
+      constexpr auto match(OkFun&& ok_fun, ErrFun&& err_fun) &&
+         -> std::common_type_t<std::invoke_result_t<OkFun, value_type&&>,
+                               std::invoke_result_t<ErrFun, error_type&&>>
       {
-         value_type m_value;
-         error_type m_error;
-      };
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), std::move(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), std::move(m_storage.second()));
+      }
+
+   private:
+      /**
+       * @brief Create a result holding the value returned by `fun` when called with `args`.
+       *
+       * The returned value is constructed directly in the storage of the result.
+       */
+      template <class Fun, class... Args>
+      constexpr result(detail::from_invoke_t, in_place_ok_t, Fun&& fun, Args&&... args) :
+         m_storage(detail::from_invoke, std::in_place_index<0>, std::forward<Fun>(fun),
+                   std::forward<Args>(args)...)
+      {}
+      /**
+       * @brief Create a result holding the error returned by `fun` when called with `args`.
+       *
+       * The returned error is constructed directly in the storage of the result.
+       */
+      template <class Fun, class... Args>
+      constexpr result(detail::from_invoke_t, in_place_err_t, Fun&& fun, Args&&... args) :
+         m_storage(detail::from_invoke, std::in_place_index<1>, std::forward<Fun>(fun),
+                   std::forward<Args>(args)...)
+      {}
+
+      /**
+       * @brief `is_ok()`, hinted with the `expected_outcome` of the result.
+       */
+      [[nodiscard]] constexpr auto expect_ok() const noexcept -> bool
+      {
+         return detail::expect_success<expected_outcome_v<result>>(is_ok());
+      }
+
+   private:
+      storage_type m_storage;
+   };
+
+   /**
+    * @brief A result is trivially relocatable if both its value and error are.
+    */
+   template <class ValueType, class ErrorType, class Check>
+   struct is_trivially_relocatable<result<ValueType, ErrorType, Check>> :
+      std::bool_constant<is_trivially_relocatable_v<ValueType> and
+                         is_trivially_relocatable_v<ErrorType>>
+   {
    };
+
+   /**
+    * @brief Create a result holding a value constructed in place from `args`.
+    *
+    * @param args The arguments forwarded to the constructor of the value.
+    *
+    * @tparam ValueType The value type of the result.
+    * @tparam ErrorType The error type of the result.
+    * @tparam Check The check policy of the result.
+    */
+   template <class ValueType, class ErrorType, check_policy Check = default_check, class... Args>
+      requires std::constructible_from<ValueType, Args...>
+   constexpr auto make_ok(Args&&... args) -> result<ValueType, ErrorType, Check>
+   {
+      return result<ValueType, ErrorType, Check>(in_place_ok, std::forward<Args>(args)...);
+   }
+
+   /**
+    * @brief Create a result holding an error constructed in place from `args`.
+    *
+    * @param args The arguments forwarded to the constructor of the error.
+    *
+    * @tparam ValueType The value type of the result.
+    * @tparam ErrorType The error type of the result.
+    * @tparam Check The check policy of the result.
+    */
+   template <class ValueType, class ErrorType, check_policy Check = default_check, class... Args>
+      requires std::constructible_from<ErrorType, Args...>
+   constexpr auto make_err(Args&&... args) -> result<ValueType, ErrorType, Check>
+   {
+      return result<ValueType, ErrorType, Check>(in_place_err, std::forward<Args>(args)...);
+   }
+
+   /**
+    * @brief Two results are equal if they hold equal values, or equal errors.
+    */
+   template <class FirstValue, class FirstError, class FirstCheck,
+             std::equality_comparable_with<FirstValue> SecondValue,
+             std::equality_comparable_with<FirstError> SecondError, class SecondCheck>
+   constexpr auto operator==(const result<FirstValue, FirstError, FirstCheck>& lhs,
+                             const result<SecondValue, SecondError, SecondCheck>& rhs) -> bool
+   {
+      if (lhs.is_ok() != rhs.is_ok())
+      {
+         return false;
+      }
+
+      if (lhs.is_ok())
+      {
+         return lhs.borrow() == rhs.borrow();
+      }
+
+      return lhs.borrow_err() == rhs.borrow_err();
+   }
+
+   template <class ValueType, class ErrorType, class Check,
+             std::equality_comparable_with<ValueType> Other>
+   constexpr auto operator==(const result<ValueType, ErrorType, Check>& r, const ok<Other>& value)
+      -> bool
+   {
+      return r.is_ok() and r.borrow() == value.value();
+   }
+
+   template <class ValueType, class ErrorType, class Check,
+             std::equality_comparable_with<ErrorType> Other>
+   constexpr auto operator==(const result<ValueType, ErrorType, Check>& r, const err<Other>& error)
+      -> bool
+   {
+      return r.is_err() and r.borrow_err() == error.value();
+   }
 } // namespace reglisse
+
+namespace std // NOLINT
+{
+   template <class ValueType, class ErrorType, class Check>
+   constexpr void swap(reglisse::result<ValueType, ErrorType, Check>& lhs,
+                       reglisse::result<ValueType, ErrorType, Check>& rhs)
+   {
+      lhs.swap(rhs);
+   }
+} // namespace std
@@ -0,0 +1,1165 @@
+/**
+ * @file shared.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Contains the shared type, a copy-on-write reference counted value.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_SHARED_HPP
+#define LIBREGLISSE_SHARED_HPP
+
+#include <libreglisse/check.hpp>
+#include <libreglisse/detail/binary_storage.hpp>
+#include <libreglisse/likelihood.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   struct shared_access;
+
+   template <check_policy Check = default_check>
+   constexpr void handle_invalid_shared_access(bool check)
+   {
+      Check::check(check, "shared value was moved from");
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief Reference count safe to share between threads.
+    *
+    * The reference count is a policy chosen at compile time, there is no runtime detection of
+    * the number of threads: values that never leave a single thread should use
+    * `local_refcount`, the non-atomic fast path.
+    */
+   class atomic_refcount
+   {
+   public:
+      void acquire() noexcept { m_count.fetch_add(1, std::memory_order_relaxed); }
+      /**
+       * @return true if the last reference was released.
+       */
+      auto release() noexcept -> bool
+      {
+         return m_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+      }
+      [[nodiscard]] auto count() const noexcept -> std::size_t
+      {
+         return m_count.load(std::memory_order_acquire);
+      }
+
+   private:
+      std::atomic<std::size_t> m_count{1};
+   };
+
+   /**
+    * @brief Reference count for values that never leave a single thread.
+    *
+    * Acquiring and releasing a reference are plain increments and decrements, without the
+    * atomic read-modify-write operations of `atomic_refcount`.
+    */
+   class local_refcount
+   {
+   public:
+      void acquire() noexcept { ++m_count; }
+      /**
+       * @return true if the last reference was released.
+       */
+      auto release() noexcept -> bool { return --m_count == 0; }
+      [[nodiscard]] auto count() const noexcept -> std::size_t { return m_count; }
+
+   private:
+      std::size_t m_count{1};
+   };
+
+   /**
+    * @brief An immutable value shared between copies through a reference count.
+    *
+    * Copying a shared only increments the reference count. The value is copied the first time it
+    * is mutated through `get_mut` while other copies still reference it, and moved out by `take`
+    * when no other copy does.
+    *
+    * Copies may be handed to other threads with the default `atomic_refcount`. `local_refcount`
+    * selects the non-atomic fast path at compile time, for values kept on a single thread.
+    *
+    * @tparam T The type of the value.
+    * @tparam RefCount The reference count policy, either `atomic_refcount` or `local_refcount`.
+    * @tparam Check The policy called when the value of a moved from shared is accessed.
+    */
+   template <std::destructible T, class RefCount = atomic_refcount,
+             check_policy Check = default_check>
+      requires(not std::is_reference_v<T>)
+   class shared
+   {
+      struct block
+      {
+         template <class... Args>
+         explicit block(Args&&... args) : value(std::forward<Args>(args)...)
+         {}
+
+         RefCount refs;
+         T value;
+      };
+
+      friend struct detail::shared_access;
+
+   public:
+      using value_type = T;
+      using refcount_type = RefCount;
+      using check_type = Check;
+
+   public:
+      /**
+       * @brief Share a value constructed in place from `args`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      explicit shared(std::in_place_t, Args&&... args) :
+         m_block(new block(std::forward<Args>(args)...))
+      {}
+      explicit shared(value_type&& value) : m_block(new block(std::move(value))) {}
+      shared(const shared& other) noexcept : m_block(other.m_block)
+      {
+         if (m_block)
+         {
+            m_block->refs.acquire();
+         }
+      }
+      shared(shared&& other) noexcept : m_block(std::exchange(other.m_block, nullptr)) {}
+      ~shared() { release(); }
+
+      auto operator=(const shared& rhs) noexcept -> shared&
+      {
+         if (m_block != rhs.m_block)
+         {
+            release();
+
+            m_block = rhs.m_block;
+            if (m_block)
+            {
+               m_block->refs.acquire();
+            }
+         }
+
+         return *this;
+      }
+      auto operator=(shared&& rhs) noexcept -> shared&
+      {
+         if (this != &rhs)
+         {
+            release();
+
+            m_block = std::exchange(rhs.m_block, nullptr);
+         }
+
+         return *this;
+      }
+
+      auto get() const -> const value_type&
+      {
+         detail::handle_invalid_shared_access<check_type>(m_block != nullptr);
+
+         return m_block->value;
+      }
+      /**
+       * @brief Access the value for mutation, copying it first if other copies reference it.
+       */
+      auto get_mut() -> value_type& requires std::copy_constructible<value_type>
+      {
+         detail::handle_invalid_shared_access<check_type>(m_block != nullptr);
+
+         return unique_value();
+      }
+      /**
+       * @brief Move the value out if no other copy references it, copy it otherwise.
+       */
+      auto take() && -> value_type requires std::copy_constructible<value_type>
+      {
+         detail::handle_invalid_shared_access<check_type>(m_block != nullptr);
+
+         return take_value();
+      }
+
+      auto operator*() const -> const value_type& { return get(); }
+      auto operator->() const -> const value_type* { return &get(); }
+
+      /**
+       * @brief The number of copies referencing the value.
+       */
+      [[nodiscard]] auto use_count() const noexcept -> std::size_t
+      {
+         return m_block ? m_block->refs.count() : 0;
+      }
+
+      template <class OtherRefCount, class OtherCheck>
+         requires std::equality_comparable<value_type>
+      auto operator==(const shared<value_type, OtherRefCount, OtherCheck>& rhs) const -> bool
+      {
+         return get() == rhs.get();
+      }
+
+   private:
+      /**
+       * @brief Create an empty shared, as left by a move.
+       */
+      explicit shared(std::nullptr_t) noexcept {}
+
+      auto unique_value() -> value_type&
+      {
+         if (m_block->refs.count() != 1)
+         {
+            auto* detached = new block(std::as_const(m_block->value));
+
+            release();
+
+            m_block = detached;
+         }
+
+         return m_block->value;
+      }
+
+      auto take_value() -> value_type
+      {
+         if (m_block->refs.count() == 1)
+         {
+            value_type value = std::move(m_block->value);
+
+            release();
+
+            return value;
+         }
+
+         value_type value = std::as_const(m_block->value);
+
+         release();
+
+         return value;
+      }
+
+      void release() noexcept
+      {
+         if (m_block && m_block->refs.release())
+         {
+            delete m_block;
+         }
+
+         m_block = nullptr;
+      }
+
+   private:
+      block* m_block = nullptr;
+   };
+
+   /**
+    * @brief A shared only holds a pointer.
+    */
+   template <class T, class RefCount, class Check>
+   struct is_trivially_relocatable<shared<T, RefCount, Check>> : std::true_type
+   {
+   };
+
+   /**
+    * @brief Share a value of type `T` constructed in place from `args`.
+    *
+    * Not named `make_shared` to avoid ambiguities with `std::make_shared` found through ADL.
+    */
+   template <class T, class RefCount = atomic_refcount, class... Args>
+      requires std::constructible_from<T, Args...>
+   auto make_shared_value(Args&&... args) -> shared<T, RefCount>
+   {
+      return shared<T, RefCount>(std::in_place, std::forward<Args>(args)...);
+   }
+
+} // namespace reglisse
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Reaches the block of a shared, for the wrappers using an empty shared as their own
+    * empty state.
+    */
+   struct shared_access
+   {
+      template <class Shared>
+      static auto make_empty() noexcept -> Shared
+      {
+         return Shared(nullptr);
+      }
+
+      template <class T, class RefCount, class Check>
+      static auto is_empty(const shared<T, RefCount, Check>& value) noexcept -> bool
+      {
+         return value.m_block == nullptr;
+      }
+
+      template <class T, class RefCount, class Check>
+      static auto value(const shared<T, RefCount, Check>& value) noexcept -> const T&
+      {
+         return value.m_block->value;
+      }
+      template <class T, class RefCount, class Check>
+      static auto value_mut(shared<T, RefCount, Check>& value) -> T&
+      {
+         return value.unique_value();
+      }
+      template <class T, class RefCount, class Check>
+      static auto take(shared<T, RefCount, Check>& value) -> T
+      {
+         return value.take_value();
+      }
+
+      /**
+       * @brief Release the shared value, if any, and share a new one constructed from `args`.
+       *
+       * The shared is empty while the new value is being built, so it stays valid if that throws.
+       */
+      template <class T, class RefCount, class Check, class... Args>
+      static auto emplace(shared<T, RefCount, Check>& value, Args&&... args) -> T&
+      {
+         using block = typename shared<T, RefCount, Check>::block;
+
+         value.release();
+         value.m_block = new block(std::forward<Args>(args)...);
+
+         return value.m_block->value;
+      }
+
+      template <class T, class RefCount, class Check>
+      static void reset(shared<T, RefCount, Check>& value) noexcept
+      {
+         value.release();
+      }
+   };
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief A maybe whose value is shared between its copies.
+    *
+    * The maybe is empty when its shared value is, so it is the size of a pointer. Copies only
+    * increment the reference count, callables receive the value as `const T&` and `borrow_mut`
+    * copies it first if other copies still reference it. Like `maybe::transform` returns a
+    * `maybe`, `transform` returns a shared_maybe using the same reference count policy.
+    *
+    * @tparam T The type of the value.
+    * @tparam RefCount The reference count policy, either `atomic_refcount` or `local_refcount`.
+    * @tparam Check The policy called when the value is accessed on an empty maybe.
+    */
+   template <std::destructible T, class RefCount = atomic_refcount,
+             check_policy Check = default_check>
+      requires(not std::is_reference_v<T>)
+   class [[nodiscard]] shared_maybe
+   {
+      using shared_type = shared<T, RefCount, Check>;
+      using access = detail::shared_access;
+
+   public:
+      using value_type = T;
+      using refcount_type = RefCount;
+      using check_type = Check;
+
+   private:
+      template <class U>
+      using rebind = shared_maybe<U, refcount_type, check_type>;
+
+   public:
+      /**
+       * @brief Create an empty monad.
+       */
+      shared_maybe() noexcept : m_shared(access::make_empty<shared_type>()) {}
+      shared_maybe(none_t) noexcept : shared_maybe() {}
+      shared_maybe(some<value_type>&& value) : m_shared(std::move(value.value())) {}
+      /**
+       * @brief Hold a value already shared with other copies.
+       */
+      shared_maybe(some<shared_type>&& value) noexcept : m_shared(std::move(value.value())) {}
+      /**
+       * @brief Create a monad holding a value constructed in place from `args`.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      explicit shared_maybe(std::in_place_t, Args&&... args) :
+         m_shared(std::in_place, std::forward<Args>(args)...)
+      {}
+
+      auto borrow() const -> const value_type&
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return access::value(m_shared);
+      }
+      /**
+       * @brief Access the value for mutation, copying it first if other copies reference it.
+       */
+      auto borrow_mut() -> value_type& requires std::copy_constructible<value_type>
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return access::value_mut(m_shared);
+      }
+      /**
+       * @brief Move the value out if no other copy references it, copy it otherwise. The maybe
+       * is left empty.
+       */
+      auto take() && -> value_type requires std::copy_constructible<value_type>
+      {
+         detail::handle_invalid_maybe_access<check_type>(is_some());
+
+         return access::take(m_shared);
+      }
+
+      /**
+       * @brief Take the value as `take` does, or `or_val` if the maybe is empty.
+       */
+      template <std::convertible_to<value_type> U>
+         requires std::copy_constructible<value_type>
+      auto take_or(U&& or_val) && -> value_type
+      {
+         if (expect_some())
+         {
+            return access::take(m_shared);
+         }
+
+         return static_cast<value_type>(std::forward<U>(or_val));
+      }
+      /**
+       * @brief Copy out the held value, or `or_val` if the maybe is empty.
+       */
+      template <std::convertible_to<value_type> U>
+         requires std::copy_constructible<value_type>
+      auto take_or(U&& or_val) const& -> value_type
+      {
+         if (expect_some())
+         {
+            return access::value(m_shared);
+         }
+
+         return static_cast<value_type>(std::forward<U>(or_val));
+      }
+
+      /**
+       * @brief Release the held value, if any, and share a new one constructed from `args`.
+       *
+       * @return A reference to the newly constructed value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      auto emplace(Args&&... args) -> value_type&
+      {
+         return access::emplace(m_shared, std::forward<Args>(args)...);
+      }
+
+      void reset() noexcept { access::reset(m_shared); }
+
+      void swap(shared_maybe& other) noexcept { std::swap(m_shared, other.m_shared); }
+
+      [[nodiscard]] auto is_some() const noexcept -> bool { return not is_none(); }
+      [[nodiscard]] auto is_none() const noexcept -> bool { return access::is_empty(m_shared); }
+      [[nodiscard]] operator bool() const noexcept { return is_some(); }
+
+      /**
+       * @brief The number of copies referencing the value, 0 if the maybe is empty.
+       */
+      [[nodiscard]] auto use_count() const noexcept -> std::size_t
+      {
+         return m_shared.use_count();
+      }
+
+      template <std::invocable<const value_type&> Fun>
+      auto transform(Fun&& some_fun) const
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>>
+      {
+         using ret = rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>>;
+
+         if (expect_some())
+         {
+            return ret(std::in_place,
+                       std::invoke(std::forward<Fun>(some_fun), access::value(m_shared)));
+         }
+
+         return none;
+      }
+
+      template <std::invocable<const value_type&> Fun, class Other>
+      auto transform_or(Fun&& some_fun, Other&& other) const
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>, Other>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_shared));
+         }
+
+         return std::forward<Other>(other);
+      }
+
+      template <std::invocable<const value_type&> Fun, std::invocable Def>
+         requires std::convertible_to<std::invoke_result_t<Fun, const value_type&>,
+                                      std::invoke_result_t<Def>>
+      auto transform_or_else(Fun&& some_fun, Def&& none_fun) const -> std::invoke_result_t<Def>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_shared));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+      template <std::invocable<const value_type&> Fun>
+      auto and_then(Fun&& some_fun) const -> std::invoke_result_t<Fun, const value_type&>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_shared));
+         }
+
+         return none;
+      }
+
+      template <std::invocable Fun>
+      auto or_else(Fun&& none_fun) && -> shared_maybe
+      {
+         if (expect_some())
+         {
+            return std::move(*this);
+         }
+
+         return std::invoke(std::forward<Fun>(none_fun));
+      }
+      template <std::invocable Fun>
+      auto or_else(Fun&& none_fun) const& -> shared_maybe
+      {
+         if (expect_some())
+         {
+            return *this;
+         }
+
+         return std::invoke(std::forward<Fun>(none_fun));
+      }
+
+      /**
+       * @brief Call `fun` with the held value, or with `none` if the maybe is empty.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, const value_type&> and std::invocable<Fun, none_t>)
+      auto match(Fun&& fun) const
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>,
+                               std::invoke_result_t<Fun, none_t>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(fun), access::value(m_shared));
+         }
+
+         return std::invoke(std::forward<Fun>(fun), none);
+      }
+      /**
+       * @brief Call `some_fun` with the held value, or `none_fun` if the maybe is empty.
+       */
+      template <std::invocable<const value_type&> Fun, std::invocable Def>
+      auto match(Fun&& some_fun, Def&& none_fun) const -> std::common_type_t<
+         std::invoke_result_t<Fun, const value_type&>, std::invoke_result_t<Def>>
+      {
+         if (expect_some())
+         {
+            return std::invoke(std::forward<Fun>(some_fun), access::value(m_shared));
+         }
+
+         return std::invoke(std::forward<Def>(none_fun));
+      }
+
+   private:
+      /**
+       * @brief `is_some()`, hinted with the `expected_outcome` of the maybe.
+       */
+      [[nodiscard]] auto expect_some() const noexcept -> bool
+      {
+         return detail::expect_success<expected_outcome_v<shared_maybe>>(is_some());
+      }
+
+   private:
+      shared_type m_shared;
+   };
+
+   static_assert(sizeof(shared_maybe<int>) == sizeof(void*),
+                 "an empty shared is the empty state of shared_maybe, it needs no flag");
+
+   /**
+    * @brief A shared_maybe only holds a pointer.
+    */
+   template <class T, class RefCount, class Check>
+   struct is_trivially_relocatable<shared_maybe<T, RefCount, Check>> : std::true_type
+   {
+   };
+
+   /**
+    * @brief Two shared_maybe are equal if both are empty, or if they hold equal values.
+    */
+   template <class First, class FirstRefCount, class FirstCheck,
+             std::equality_comparable_with<First> Second, class SecondRefCount,
+             class SecondCheck>
+   auto operator==(const shared_maybe<First, FirstRefCount, FirstCheck>& lhs,
+                   const shared_maybe<Second, SecondRefCount, SecondCheck>& rhs) -> bool
+   {
+      if (lhs.is_some() != rhs.is_some())
+      {
+         return false;
+      }
+
+      if (lhs.is_none())
+      {
+         return true;
+      }
+
+      return lhs.borrow() == rhs.borrow();
+   }
+
+   template <class T, class RefCount, class Check>
+   auto operator==(const shared_maybe<T, RefCount, Check>& m, none_t) noexcept -> bool
+   {
+      return m.is_none();
+   }
+
+   template <class T, class RefCount, class Check, class Other>
+   auto operator==(const shared_maybe<T, RefCount, Check>& m,
+                   const Other& value) noexcept(noexcept(m.borrow() == value)) -> bool
+   {
+      return m.is_some() ? m.borrow() == value : false;
+   }
+
+   template <class First, class FirstRefCount, class FirstCheck, class Second,
+             class SecondRefCount, class SecondCheck>
+   auto operator<=>(const shared_maybe<First, FirstRefCount, FirstCheck>& lhs,
+                    const shared_maybe<Second, SecondRefCount, SecondCheck>& rhs)
+      -> std::compare_three_way_result_t<First, Second>
+   {
+      if (lhs.is_some() && rhs.is_some())
+      {
+         return lhs.borrow() <=> rhs.borrow();
+      }
+
+      return lhs.is_some() <=> rhs.is_some();
+   }
+
+   template <class T, class RefCount, class Check>
+   auto operator<=>(const shared_maybe<T, RefCount, Check>& m, none_t) noexcept
+      -> std::strong_ordering
+   {
+      return m.is_some() <=> false;
+   }
+
+   template <class T, class RefCount, class Check, class Other>
+   auto operator<=>(const shared_maybe<T, RefCount, Check>& m,
+                    const Other& value) noexcept(noexcept(m.borrow() <=> value))
+      -> std::compare_three_way_result_t<T, Other>
+   {
+      return m.is_some() ? m.borrow() <=> value : std::strong_ordering::less;
+   }
+
+   /**
+    * @brief A result whose value is shared between its copies.
+    *
+    * The result is as large as the larger of a pointer and `E`, plus the discriminant. Copies
+    * only increment the reference count of the value, callables receive it as `const T&` and
+    * `borrow_mut` copies it first if other copies still reference it. Like the operations of
+    * `result` return a `result`, `transform` and `transform_err` return a shared_result: a new
+    * value is shared using the same reference count policy, a kept value stays shared.
+    *
+    * A moved from shared_result still holds a value, but no longer references it. Accessing that
+    * value calls the check policy.
+    *
+    * @tparam T The type of the value.
+    * @tparam E The type of the error.
+    * @tparam RefCount The reference count policy, either `atomic_refcount` or `local_refcount`.
+    * @tparam Check The policy called when the value or the error is accessed on the wrong side.
+    */
+   template <std::destructible T, std::destructible E, class RefCount = atomic_refcount,
+             check_policy Check = default_check>
+      requires(not(std::is_reference_v<T> or std::is_reference_v<E>))
+   class [[nodiscard]] shared_result
+   {
+      using shared_type = shared<T, RefCount, Check>;
+      using storage_type = detail::binary_storage<shared_type, E>;
+      using access = detail::shared_access;
+
+   public:
+      using value_type = T;
+      using error_type = E;
+      using refcount_type = RefCount;
+      using check_type = Check;
+
+   private:
+      template <class OtherValue, class OtherError>
+      using rebind = shared_result<OtherValue, OtherError, refcount_type, check_type>;
+
+      template <class value_fun, class error_fun>
+      using join_result = std::common_type_t<std::invoke_result_t<value_fun, const value_type&>,
+                                             std::invoke_result_t<error_fun, error_type>>;
+
+      /**
+       * @brief The monad returned by `Fun`, or a `result` widening its error when it differs from
+       * `error_type`.
+       */
+      template <class Fun>
+      using and_then_result = std::conditional_t<
+         std::same_as<typename std::invoke_result_t<Fun, const value_type&>::error_type,
+                      error_type>,
+         std::invoke_result_t<Fun, const value_type&>,
+         result<typename std::invoke_result_t<Fun, const value_type&>::value_type,
+                detail::widen_error_t<
+                   error_type, typename std::invoke_result_t<Fun, const value_type&>::error_type>,
+                typename std::invoke_result_t<Fun, const value_type&>::check_type>>;
+
+   public:
+      shared_result(ok<value_type>&& value) :
+         m_storage(std::in_place_index<0>, std::move(value.value()))
+      {}
+      /**
+       * @brief Hold a value already shared with other copies.
+       */
+      shared_result(ok<shared_type>&& value) :
+         m_storage(std::in_place_index<0>, std::move(value.value()))
+      {}
+      shared_result(err<error_type>&& error) :
+         m_storage(std::in_place_index<1>, std::move(error.value()))
+      {}
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      explicit shared_result(in_place_ok_t, Args&&... args) :
+         m_storage(std::in_place_index<0>, std::in_place, std::forward<Args>(args)...)
+      {}
+      template <class... Args>
+         requires std::constructible_from<error_type, Args...>
+      explicit shared_result(in_place_err_t, Args&&... args) :
+         m_storage(std::in_place_index<1>, std::forward<Args>(args)...)
+      {}
+
+      void swap(shared_result& other) requires std::move_constructible<error_type>
+      {
+         std::swap(m_storage, other.m_storage);
+      }
+
+      auto borrow() const -> const value_type&
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return value();
+      }
+      /**
+       * @brief Access the value for mutation, copying it first if other copies reference it.
+       */
+      auto borrow_mut() -> value_type& requires std::copy_constructible<value_type>
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return m_storage.first().get_mut();
+      }
+      /**
+       * @brief Move the value out if no other copy references it, copy it otherwise.
+       */
+      auto take() && -> value_type requires std::copy_constructible<value_type>
+      {
+         detail::handle_invalid_value_result_access<check_type>(is_ok());
+
+         return take_value();
+      }
+
+      /**
+       * @brief Take the value as `take` does, or `other` if the result holds an error.
+       */
+      template <std::convertible_to<value_type> U>
+         requires std::copy_constructible<value_type>
+      auto take_or(U&& other) && -> value_type
+      {
+         if (expect_ok())
+         {
+            return take_value();
+         }
+
+         return std::forward<U>(other);
+      }
+      /**
+       * @brief Copy out the held value, or `other` if the result holds an error.
+       */
+      template <std::convertible_to<value_type> U>
+         requires std::copy_constructible<value_type>
+      auto take_or(U&& other) const& -> value_type
+      {
+         if (expect_ok())
+         {
+            return value();
+         }
+
+         return std::forward<U>(other);
+      }
+
+      auto borrow_err() & -> error_type&
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return m_storage.second();
+      }
+      auto borrow_err() const& -> const error_type&
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return m_storage.second();
+      }
+      auto take_err() && -> error_type
+      {
+         detail::handle_invalid_error_result_access<check_type>(is_err());
+
+         return std::move(m_storage.second());
+      }
+
+      template <std::convertible_to<error_type> U>
+      auto take_err_or(U&& other) && -> error_type
+      {
+         if (not expect_ok())
+         {
+            return std::move(m_storage.second());
+         }
+
+         return std::forward<U>(other);
+      }
+      template <std::convertible_to<error_type> U>
+         requires std::copy_constructible<error_type>
+      auto take_err_or(U&& other) const& -> error_type
+      {
+         if (not expect_ok())
+         {
+            return m_storage.second();
+         }
+
+         return std::forward<U>(other);
+      }
+
+      /**
+       * @brief Release the held value or destroy the held error, and share a new value
+       * constructed from `args`.
+       *
+       * @return A reference to the newly constructed value.
+       */
+      template <class... Args>
+         requires std::constructible_from<value_type, Args...>
+      auto emplace(Args&&... args) -> value_type&
+      {
+         if (is_ok())
+         {
+            return access::emplace(m_storage.first(), std::forward<Args>(args)...);
+         }
+
+         return access::value_mut(
+            m_storage.emplace_first(std::in_place, std::forward<Args>(args)...));
+      }
+      template <class... Args>
+         requires std::constructible_from<error_type, Args...>
+      auto emplace_err(Args&&... args) -> error_type&
+      {
+         return m_storage.emplace_second(std::forward<Args>(args)...);
+      }
+
+      [[nodiscard]] auto is_ok() const noexcept -> bool { return m_storage.is_first(); }
+      [[nodiscard]] auto is_err() const noexcept -> bool { return not is_ok(); }
+      explicit operator bool() const noexcept { return is_ok(); }
+
+      /**
+       * @brief The number of copies referencing the value, 0 if the result holds an error.
+       */
+      [[nodiscard]] auto use_count() const noexcept -> std::size_t
+      {
+         return is_ok() ? m_storage.first().use_count() : 0;
+      }
+
+      template <std::invocable<const value_type&> Fun>
+      auto transform(Fun&& fun) &&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>;
+
+         if (expect_ok())
+         {
+            return ret(in_place_ok, std::invoke(std::forward<Fun>(fun), value()));
+         }
+
+         return ret(in_place_err, std::move(m_storage.second()));
+      }
+      template <std::invocable<const value_type&> Fun>
+         requires std::copy_constructible<error_type>
+      auto transform(Fun&& fun) const&
+         -> rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>
+      {
+         using ret =
+            rebind<std::remove_cvref_t<std::invoke_result_t<Fun, const value_type&>>, error_type>;
+
+         if (expect_ok())
+         {
+            return ret(in_place_ok, std::invoke(std::forward<Fun>(fun), value()));
+         }
+
+         return ret(in_place_err, m_storage.second());
+      }
+
+      /**
+       * @brief Map the held error, if any. The value, if any, stays shared with other copies.
+       */
+      template <detail::ensure_error_mapper<error_type> Fun>
+      auto transform_err(Fun&& err_fun) &&
+         -> rebind<value_type, detail::map_error_result_t<Fun, error_type>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, error_type>>;
+
+         if (not expect_ok())
+         {
+            return ret(in_place_err, detail::map_error(std::forward<Fun>(err_fun),
+                                                       std::move(m_storage.second())));
+         }
+
+         return ret(ok(std::move(m_storage.first())));
+      }
+      template <detail::ensure_error_mapper<const error_type&> Fun>
+      auto transform_err(Fun&& err_fun) const&
+         -> rebind<value_type, detail::map_error_result_t<Fun, const error_type&>>
+      {
+         using ret = rebind<value_type, detail::map_error_result_t<Fun, const error_type&>>;
+
+         if (not expect_ok())
+         {
+            return ret(in_place_err,
+                       detail::map_error(std::forward<Fun>(err_fun), m_storage.second()));
+         }
+
+         return ret(ok(shared_type(m_storage.first())));
+      }
+
+      /**
+       * @brief Chain a callable returning a result. When the error type of that result differs
+       * from `error_type`, both are widened as for `result::and_then`.
+       */
+      template <detail::ensure_value_result<const value_type&, error_type> Fun>
+      auto and_then(Fun&& fun) && -> and_then_result<Fun>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         using error = typename and_then_result<Fun>::error_type;
+
+         return err(error(std::move(m_storage.second())));
+      }
+      template <detail::ensure_value_result<const value_type&, error_type> Fun>
+         requires std::copy_constructible<error_type>
+      auto and_then(Fun&& fun) const& -> and_then_result<Fun>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         using error = typename and_then_result<Fun>::error_type;
+
+         return err(error(m_storage.second()));
+      }
+
+      /**
+       * @brief Recover from the held error, if any. The value, if any, stays shared with other
+       * copies.
+       */
+      template <std::invocable<error_type&&> Fun>
+         requires std::constructible_from<std::invoke_result_t<Fun, error_type&&>,
+                                          ok<shared_type>>
+      auto or_else(Fun&& err_fun) && -> std::invoke_result_t<Fun, error_type&&>
+      {
+         if (expect_ok())
+         {
+            return ok(std::move(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(err_fun), std::move(m_storage.second()));
+      }
+      template <std::invocable<const error_type&> Fun>
+         requires std::constructible_from<std::invoke_result_t<Fun, const error_type&>,
+                                          ok<shared_type>>
+      auto or_else(Fun&& err_fun) const& -> std::invoke_result_t<Fun, const error_type&>
+      {
+         if (expect_ok())
+         {
+            return ok(shared_type(m_storage.first()));
+         }
+
+         return std::invoke(std::forward<Fun>(err_fun), m_storage.second());
+      }
+
+      /**
+       * @brief Take the value as `take` does, or move out the error, whichever is held.
+       */
+      template <class inner_value_ = value_type, class inner_error_ = error_type>
+         requires std::copy_constructible<value_type>
+      auto join() && -> std::common_type_t<inner_value_, inner_error_>
+      {
+         if (expect_ok())
+         {
+            return take_value();
+         }
+
+         return std::move(m_storage.second());
+      }
+
+      template <std::invocable<const value_type&> OkFun, std::invocable<error_type> ErrFun>
+      auto join(OkFun&& ok_fun, ErrFun&& err_fun) && -> join_result<OkFun, ErrFun>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), std::move(m_storage.second()));
+      }
+      template <std::invocable<const value_type&> OkFun, std::invocable<const error_type&> ErrFun>
+      auto join(OkFun&& ok_fun, ErrFun&& err_fun) const&
+         -> std::common_type_t<std::invoke_result_t<OkFun, const value_type&>,
+                               std::invoke_result_t<ErrFun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+
+      /**
+       * @brief Call `fun` with either the held value or the held error.
+       */
+      template <class Fun>
+         requires(std::invocable<Fun, const value_type&> and
+                  std::invocable<Fun, const error_type&>)
+      auto match(Fun&& fun) const
+         -> std::common_type_t<std::invoke_result_t<Fun, const value_type&>,
+                               std::invoke_result_t<Fun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<Fun>(fun), value());
+         }
+
+         return std::invoke(std::forward<Fun>(fun), m_storage.second());
+      }
+      /**
+       * @brief Call `ok_fun` with the held value, or `err_fun` with the held error.
+       */
+      template <std::invocable<const value_type&> OkFun,
+                std::invocable<const error_type&> ErrFun>
+      auto match(OkFun&& ok_fun, ErrFun&& err_fun) const
+         -> std::common_type_t<std::invoke_result_t<OkFun, const value_type&>,
+                               std::invoke_result_t<ErrFun, const error_type&>>
+      {
+         if (expect_ok())
+         {
+            return std::invoke(std::forward<OkFun>(ok_fun), value());
+         }
+
+         return std::invoke(std::forward<ErrFun>(err_fun), m_storage.second());
+      }
+
+   private:
+      /**
+       * @brief The shared value, checked against the empty shared left by a move.
+       */
+      [[nodiscard]] auto value() const -> const value_type& { return m_storage.first().get(); }
+      /**
+       * @brief Move the value out as `shared::take` does, checked against a moved from shared.
+       */
+      auto take_value() -> value_type { return std::move(m_storage.first()).take(); }
+
+      /**
+       * @brief `is_ok()`, hinted with the `expected_outcome` of the result.
+       */
+      [[nodiscard]] auto expect_ok() const noexcept -> bool
+      {
+         return detail::expect_success<expected_outcome_v<shared_result>>(is_ok());
+      }
+
+   private:
+      storage_type m_storage;
+   };
+
+   /**
+    * @brief A shared_result is trivially relocatable if its error is.
+    */
+   template <class T, class E, class RefCount, class Check>
+   struct is_trivially_relocatable<shared_result<T, E, RefCount, Check>> :
+      is_trivially_relocatable<E>
+   {
+   };
+
+   /**
+    * @brief Two shared_result are equal if they hold equal values, or equal errors.
+    */
+   template <class FirstValue, class FirstError, class FirstRefCount, class FirstCheck,
+             std::equality_comparable_with<FirstValue> SecondValue,
+             std::equality_comparable_with<FirstError> SecondError, class SecondRefCount,
+             class SecondCheck>
+   auto operator==(const shared_result<FirstValue, FirstError, FirstRefCount, FirstCheck>& lhs,
+                   const shared_result<SecondValue, SecondError, SecondRefCount, SecondCheck>& rhs)
+      -> bool
+   {
+      if (lhs.is_ok() != rhs.is_ok())
+      {
+         return false;
+      }
+
+      if (lhs.is_ok())
+      {
+         return lhs.borrow() == rhs.borrow();
+      }
+
+      return lhs.borrow_err() == rhs.borrow_err();
+   }
+
+   template <class T, class E, class RefCount, class Check, std::equality_comparable_with<T> Other>
+   auto operator==(const shared_result<T, E, RefCount, Check>& r, const ok<Other>& value) -> bool
+   {
+      return r.is_ok() and r.borrow() == value.value();
+   }
+
+   template <class T, class E, class RefCount, class Check, std::equality_comparable_with<E> Other>
+   auto operator==(const shared_result<T, E, RefCount, Check>& r, const err<Other>& error) -> bool
+   {
+      return r.is_err() and r.borrow_err() == error.value();
+   }
+} // namespace reglisse
+
+namespace std // NOLINT
+{
+   template <class T, class RefCount, class Check>
+   void swap(reglisse::shared_maybe<T, RefCount, Check>& lhs,
+             reglisse::shared_maybe<T, RefCount, Check>& rhs) noexcept
+   {
+      lhs.swap(rhs);
+   }
+
+   template <class T, class E, class RefCount, class Check>
+   void swap(reglisse::shared_result<T, E, RefCount, Check>& lhs,
+             reglisse::shared_result<T, E, RefCount, Check>& rhs)
+   {
+      lhs.swap(rhs);
+   }
+} // namespace std
+
+#endif // LIBREGLISSE_SHARED_HPP
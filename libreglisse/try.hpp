@@ -10,6 +10,9 @@
 
 #include <libreglisse/result.hpp>
 
+#include <functional>
+#include <type_traits>
+
 namespace reglisse
 {
    /**
@@ -18,6 +21,11 @@ namespace reglisse
     * Calls a function that may throw an exception and transform the return type into a result
     * monad that contains either the return type of the function, or the exception type.
     *
+    * When exceptions are disabled (`-fno-exceptions`), nothing can be thrown, so the returned
+    * result always holds the value returned by `fun`. Code built that way should report its
+    * errors by returning a result directly, for instance `err(ErrType(...))`, instead of
+    * relying on `try_wrap`.
+    *
     * @param fun The function to call.
     * @param args The arguments of the function.
     *
@@ -28,14 +36,23 @@ namespace reglisse
    template <class ErrType, class Fun, class... Args>
       requires std::invocable<Fun, Args...>
    constexpr auto try_wrap(Fun&& fun, Args&&... args)
+      -> result<std::invoke_result_t<Fun, Args...>, ErrType>
    {
+      using value_type = std::invoke_result_t<Fun, Args...>;
+
+#if defined(__cpp_exceptions)
       try
       {
-         return std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...);
+         return result<value_type, ErrType>(
+            in_place_ok, std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...));
       }
       catch (const ErrType& e)
       {
-         return err(e);
+         return err(ErrType(e));
       }
+#else
+      return result<value_type, ErrType>(
+         in_place_ok, std::invoke(std::forward<Fun>(fun), std::forward<Args>(args)...));
+#endif // defined(__cpp_exceptions)
    }
 } // namespace reglisse
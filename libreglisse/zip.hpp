@@ -0,0 +1,265 @@
+/**
+ * @file zip.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Friday, 16th of october 2026
+ * @brief Utility functions to combine multiple monadic types into one.
+ * @copyright Copyright (C) 2021 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ZIP_HPP
+#define LIBREGLISSE_ZIP_HPP
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::detail
+{
+   /**
+    * @brief Reads the values of monads already known to hold one, and constructs the combined
+    * monad in place.
+    *
+    * `zip` and `lift` test every monad once, in a single combined test. Going through `take()`
+    * afterwards would run the check policy of each monad again, and wrapping the combined value
+    * in `some` or `ok` would move it once more.
+    */
+   struct zip_access
+   {
+      template <class T, class Check>
+      static constexpr auto value(maybe<T, Check>& m) noexcept -> T&&
+      {
+         return std::move(m.m_value); // NOLINT
+      }
+      template <class T, class E, class Check>
+      static constexpr auto value(result<T, E, Check>& r) noexcept -> T&&
+      {
+         return std::move(r.m_storage.first());
+      }
+      template <class T, class E, class Check>
+      static constexpr auto error(result<T, E, Check>& r) noexcept -> E&&
+      {
+         return std::move(r.m_storage.second());
+      }
+
+      template <class T, class Check, class Fun, class... Args>
+      static constexpr auto invoke_some(Fun&& fun, Args&&... args) -> maybe<T, Check>
+      {
+         return maybe<T, Check>(from_invoke, std::forward<Fun>(fun), std::forward<Args>(args)...);
+      }
+      template <class T, class E, class Check, class Fun, class... Args>
+      static constexpr auto invoke_ok(Fun&& fun, Args&&... args) -> result<T, E, Check>
+      {
+         return result<T, E, Check>(from_invoke, in_place_ok, std::forward<Fun>(fun),
+                                    std::forward<Args>(args)...);
+      }
+   };
+
+   /**
+    * @brief Builds the tuple of `zip` from the values of the monads, in place.
+    */
+   template <class... Ts>
+   struct make_tuple_fn
+   {
+      constexpr auto operator()(Ts&&... values) const -> std::tuple<Ts...>
+      {
+         return std::tuple<Ts...>(std::move(values)...);
+      }
+   };
+
+   template <class Policy, class... Errors>
+   concept error_policy = (std::invocable<Policy, Errors&&> and ...) and requires
+   {
+      typename std::common_type_t<std::invoke_result_t<Policy, Errors&&>...>;
+   };
+
+   template <class Policy, class... Errors>
+   using common_error_t =
+      std::remove_cvref_t<std::common_type_t<std::invoke_result_t<Policy, Errors&&>...>>;
+
+   /**
+    * @brief Fetch the first error found in a list of results, mapped through the error policy.
+    *
+    * Only called once we already know that at least one of the results holds an error, so the
+    * errors are read without going through the check policy of the results.
+    */
+   template <class Error, class Policy, class First, class... Rest>
+   constexpr auto first_error(Policy&& policy, First& first, Rest&... rest) -> Error
+   {
+      if constexpr (sizeof...(Rest) == 0)
+      {
+         return static_cast<Error>(
+            std::invoke(std::forward<Policy>(policy), zip_access::error(first)));
+      }
+      else
+      {
+         if (first.is_err())
+         {
+            return static_cast<Error>(
+               std::invoke(std::forward<Policy>(policy), zip_access::error(first)));
+         }
+
+         return first_error<Error>(std::forward<Policy>(policy), rest...);
+      }
+   }
+} // namespace reglisse::detail
+
+namespace reglisse
+{
+   /**
+    * @brief Combine multiple maybe monads into a single maybe holding a tuple of all the values.
+    *
+    * Every maybe is checked in a single combined test, if any of them is empty, the resulting
+    * maybe will be empty as well.
+    *
+    * @param maybes The maybe monads to combine.
+    *
+    * @tparam Ts The types held by the maybe monads.
+    */
+   template <check_policy Check, class... Ts>
+      requires(sizeof...(Ts) > 0)
+   constexpr auto zip(maybe<Ts, Check>&&... maybes) -> maybe<std::tuple<Ts...>, Check>
+   {
+      if ((maybes.is_some() & ...))
+      {
+         return detail::zip_access::invoke_some<std::tuple<Ts...>, Check>(
+            detail::make_tuple_fn<Ts...>(), detail::zip_access::value(maybes)...);
+      }
+
+      return none;
+   }
+
+   /**
+    * @brief Call a function using the values held by multiple maybe monads.
+    *
+    * Every maybe is checked in a single combined test, the function is only called if all of
+    * them hold a value.
+    *
+    * @param fun The function to call.
+    * @param maybes The maybe monads holding the arguments of the function.
+    *
+    * @tparam Fun The type of the function.
+    * @tparam Ts The types held by the maybe monads.
+    */
+   template <class Fun, check_policy Check, class... Ts>
+      requires(sizeof...(Ts) > 0 and std::invocable<Fun, Ts&&...>)
+   constexpr auto lift(Fun&& fun, maybe<Ts, Check>&&... maybes)
+      -> maybe<std::invoke_result_t<Fun, Ts&&...>, Check>
+   {
+      if ((maybes.is_some() & ...))
+      {
+         return detail::zip_access::invoke_some<std::invoke_result_t<Fun, Ts&&...>, Check>(
+            std::forward<Fun>(fun), detail::zip_access::value(maybes)...);
+      }
+
+      return none;
+   }
+
+   /**
+    * @brief Combine multiple result monads into a single result holding a tuple of all the
+    * values.
+    *
+    * Every result is checked in a single combined test. If any of them holds an error, the
+    * first error found is mapped through the `policy` into the resulting result.
+    *
+    * @param policy The callable used to map each error type into a common error type.
+    * @param results The result monads to combine.
+    *
+    * @tparam ErrorPolicy The type of the error policy.
+    * @tparam Ts The value types held by the result monads.
+    * @tparam Es The error types held by the result monads.
+    */
+   template <class ErrorPolicy, check_policy Check, class... Ts, class... Es>
+      requires(sizeof...(Ts) > 0 and detail::error_policy<ErrorPolicy, Es...>)
+   constexpr auto zip(ErrorPolicy&& policy, result<Ts, Es, Check>&&... results)
+      -> result<std::tuple<Ts...>, detail::common_error_t<ErrorPolicy, Es...>, Check>
+   {
+      using error_type = detail::common_error_t<ErrorPolicy, Es...>;
+
+      if ((results.is_ok() & ...))
+      {
+         return detail::zip_access::invoke_ok<std::tuple<Ts...>, error_type, Check>(
+            detail::make_tuple_fn<Ts...>(), detail::zip_access::value(results)...);
+      }
+
+      return err(detail::first_error<error_type>(std::forward<ErrorPolicy>(policy), results...));
+   }
+
+   /**
+    * @brief Combine multiple result monads into a single result holding a tuple of all the
+    * values. The error types have to share a common type.
+    *
+    * @param results The result monads to combine.
+    *
+    * @tparam Ts The value types held by the result monads.
+    * @tparam Es The error types held by the result monads.
+    */
+   template <check_policy Check, class... Ts, class... Es>
+      requires(sizeof...(Ts) > 0 and detail::error_policy<std::identity, Es...>)
+   constexpr auto zip(result<Ts, Es, Check>&&... results)
+      -> result<std::tuple<Ts...>, detail::common_error_t<std::identity, Es...>, Check>
+   {
+      return zip(std::identity(), std::move(results)...);
+   }
+
+   /**
+    * @brief Call a function using the values held by multiple result monads.
+    *
+    * Every result is checked in a single combined test, the function is only called if all of
+    * them hold a value. Otherwise, the first error found is mapped through the `policy` into the
+    * resulting result.
+    *
+    * @param policy The callable used to map each error type into a common error type.
+    * @param fun The function to call.
+    * @param results The result monads holding the arguments of the function.
+    *
+    * @tparam ErrorPolicy The type of the error policy.
+    * @tparam Fun The type of the function.
+    * @tparam Ts The value types held by the result monads.
+    * @tparam Es The error types held by the result monads.
+    */
+   template <class ErrorPolicy, class Fun, check_policy Check, class... Ts, class... Es>
+      requires(sizeof...(Ts) > 0 and std::invocable<Fun, Ts&&...> and
+               detail::error_policy<ErrorPolicy, Es...>)
+   constexpr auto lift(ErrorPolicy&& policy, Fun&& fun, result<Ts, Es, Check>&&... results)
+      -> result<std::invoke_result_t<Fun, Ts&&...>, detail::common_error_t<ErrorPolicy, Es...>,
+                Check>
+   {
+      using error_type = detail::common_error_t<ErrorPolicy, Es...>;
+
+      if ((results.is_ok() & ...))
+      {
+         return detail::zip_access::invoke_ok<std::invoke_result_t<Fun, Ts&&...>, error_type,
+                                              Check>(std::forward<Fun>(fun),
+                                                     detail::zip_access::value(results)...);
+      }
+
+      return err(detail::first_error<error_type>(std::forward<ErrorPolicy>(policy), results...));
+   }
+
+   /**
+    * @brief Call a function using the values held by multiple result monads. The error types
+    * have to share a common type.
+    *
+    * @param fun The function to call.
+    * @param results The result monads holding the arguments of the function.
+    *
+    * @tparam Fun The type of the function.
+    * @tparam Ts The value types held by the result monads.
+    * @tparam Es The error types held by the result monads.
+    */
+   template <class Fun, check_policy Check, class... Ts, class... Es>
+      requires(sizeof...(Ts) > 0 and std::invocable<Fun, Ts&&...> and
+               detail::error_policy<std::identity, Es...>)
+   constexpr auto lift(Fun&& fun, result<Ts, Es, Check>&&... results)
+      -> result<std::invoke_result_t<Fun, Ts&&...>, detail::common_error_t<std::identity, Es...>,
+                Check>
+   {
+      return lift(std::identity(), std::forward<Fun>(fun), std::move(results)...);
+   }
+} // namespace reglisse
+
+#endif // LIBREGLISSE_ZIP_HPP
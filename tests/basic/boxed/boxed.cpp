@@ -0,0 +1,444 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#include <libreglisse/boxed.hpp>
+#include <libreglisse/error_union.hpp>
+#include <libreglisse/overloaded.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace reglisse;
+
+namespace
+{
+   struct huge_report
+   {
+      std::array<std::uint64_t, 128> samples{};
+      std::string title;
+   };
+} // namespace
+
+TEST_CASE("boxed - layout", "[boxed]")
+{
+   static_assert(sizeof(boxed<huge_report>) == sizeof(void*));
+   static_assert(sizeof(result_box<huge_report, int>) == 2 * sizeof(void*));
+   static_assert(sizeof(result_box<huge_report, huge_report>) > sizeof(huge_report));
+   static_assert(sizeof(maybe_box<huge_report>) == sizeof(void*));
+
+   static_assert(is_trivially_relocatable_v<boxed<huge_report>>);
+   static_assert(is_trivially_relocatable_v<maybe_box<huge_report>>);
+   static_assert(is_trivially_relocatable_v<result_box<huge_report, int>>);
+   static_assert(not is_trivially_relocatable_v<
+                 boxed<huge_report, std::pmr::polymorphic_allocator<huge_report>>>);
+}
+
+TEST_CASE("boxed - value semantics", "[boxed]")
+{
+   SECTION("construction")
+   {
+      const auto box = make_boxed<huge_report>(huge_report{.samples = {1, 2}, .title = "report"});
+
+      CHECK(box->title == "report");
+      CHECK((*box).samples[1] == 2);
+   }
+   SECTION("copies are deep")
+   {
+      auto box = make_boxed<std::string>("hello");
+      auto copy = box;
+
+      copy.get() += " world";
+
+      CHECK(box.get() == "hello");
+      CHECK(copy.get() == "hello world");
+   }
+   SECTION("moves transfer the pointer")
+   {
+      auto box = make_boxed<std::string>("hello");
+      const std::string* address = &box.get();
+
+      const boxed<std::string> moved = std::move(box);
+
+      CHECK(&moved.get() == address);
+   }
+   SECTION("take")
+   {
+      auto box = make_boxed<std::string>(3, 'a');
+
+      CHECK(std::move(box).take() == "aaa");
+   }
+}
+
+TEST_CASE("boxed - maybe_box", "[boxed]")
+{
+   static_assert(std::is_same_v<maybe_box<huge_report>::value_type, huge_report>);
+
+   maybe_box<std::string> name = some(std::string("name"));
+
+   SECTION("an empty box is none")
+   {
+      maybe_box<std::string> empty = none;
+
+      CHECK(empty.is_none());
+      CHECK(empty == none);
+
+      empty.emplace(3, 'a');
+
+      REQUIRE(empty.is_some());
+      CHECK(empty.borrow() == "aaa");
+
+      empty.reset();
+
+      CHECK(empty.is_none());
+   }
+   SECTION("a moved from maybe_box is none")
+   {
+      const maybe_box<std::string> moved = std::move(name);
+
+      CHECK(name.is_none()); // NOLINT
+      CHECK(moved.borrow() == "name");
+   }
+   SECTION("copies are deep")
+   {
+      maybe_box<std::string> copy = name;
+
+      copy.borrow() += "d";
+
+      CHECK(name.borrow() == "name");
+      CHECK(copy.borrow() == "named");
+   }
+   SECTION("accessors return the value")
+   {
+      std::string& value = name.borrow();
+
+      value += "d";
+
+      CHECK(name.borrow() == "named");
+      CHECK(std::move(name).take() == "named");
+   }
+   SECTION("callables receive the value")
+   {
+      const maybe_box<std::size_t> size = name.transform([](const std::string& value) {
+         return value.size();
+      });
+      const maybe_box<std::string> moved = std::move(name).transform([](std::string&& value) {
+         return std::move(value);
+      });
+      const maybe<char> first = moved.and_then([](const std::string& value) -> maybe<char> {
+         return some(char(value.front()));
+      });
+
+      CHECK(size.borrow() == 4);
+      CHECK(moved.borrow() == "name");
+      CHECK(first.borrow() == 'n');
+   }
+   SECTION("transform_or and transform_or_else")
+   {
+      const maybe_box<std::string> empty = none;
+      const auto size = [](const std::string& value) {
+         return value.size();
+      };
+      const auto zero = [] {
+         return std::size_t(0);
+      };
+
+      CHECK(name.transform_or(size, std::size_t(0)) == 4);
+      CHECK(empty.transform_or(size, std::size_t(0)) == 0);
+      CHECK(name.transform_or_else(size, zero) == 4);
+      CHECK(empty.transform_or_else(size, zero) == 0);
+      CHECK(std::move(name).transform_or_else(
+               [](std::string&& value) {
+                  return value.size() + 1;
+               },
+               zero) == 5);
+   }
+   SECTION("take_or")
+   {
+      const maybe_box<std::string> empty = none;
+
+      CHECK(name.take_or("other") == "name");
+      CHECK(name.is_some());
+      CHECK(empty.take_or("other") == "other");
+      CHECK(std::move(name).take_or("other") == "name");
+   }
+   SECTION("match with a single callable")
+   {
+      const maybe_box<std::string> empty = none;
+      const overloaded size{[](const std::string& value) {
+                               return value.size();
+                            },
+                            [](none_t) {
+                               return std::size_t(0);
+                            }};
+
+      CHECK(name.match(size) == 4);
+      CHECK(empty.match(size) == 0);
+   }
+   SECTION("comparisons")
+   {
+      const maybe_box<std::string> empty = none;
+      const maybe_box<std::string> other = some(std::string("other"));
+
+      CHECK(name == std::string("name"));
+      CHECK(name != std::string("other"));
+      CHECK(name == maybe_box<std::string>(name));
+      CHECK(name != other);
+      CHECK(empty != name);
+      CHECK(name < other);
+      CHECK(empty < name);
+      CHECK(name > none);
+      CHECK(name < std::string("other"));
+   }
+   SECTION("swap")
+   {
+      maybe_box<std::string> empty = none;
+
+      std::swap(name, empty);
+
+      CHECK(name.is_none());
+      CHECK(empty.borrow() == "name");
+   }
+   SECTION("transform keeps the allocator")
+   {
+      std::pmr::unsynchronized_pool_resource pool;
+
+      using pool_allocator = std::pmr::polymorphic_allocator<std::string>;
+
+      const maybe_box<std::string, pool_allocator> pooled(
+         std::allocator_arg, pool_allocator(&pool), std::in_place, "pooled");
+
+      const auto size = pooled.transform([](const std::string& value) {
+         return value.size();
+      });
+
+      static_assert(std::is_same_v<std::remove_cvref_t<decltype(size)>,
+                                   maybe_box<std::size_t,
+                                             std::pmr::polymorphic_allocator<std::size_t>>>);
+
+      CHECK(size.borrow() == 6);
+      CHECK(size.get_allocator().resource() == &pool);
+   }
+   SECTION("or_else and match")
+   {
+      maybe_box<std::string> empty = none;
+
+      const maybe_box<std::string> recovered = std::move(empty).or_else([] {
+         return maybe_box<std::string>(some(std::string("default")));
+      });
+
+      CHECK(recovered.borrow() == "default");
+      CHECK(name.match(
+               [](const std::string& value) {
+                  return value.size();
+               },
+               [] {
+                  return std::size_t(0);
+               }) == 4);
+   }
+}
+
+TEST_CASE("boxed - result_box", "[boxed]")
+{
+   static_assert(std::is_same_v<result_box<huge_report, int>::value_type, huge_report>);
+
+   const auto parse = [](bool fail) -> result_box<huge_report, int> {
+      if (fail)
+      {
+         return err(-1);
+      }
+
+      return result_box<huge_report, int>(in_place_ok,
+                                          huge_report{.samples = {}, .title = "parsed"});
+   };
+
+   SECTION("accessors return the value")
+   {
+      CHECK(parse(true).borrow_err() == -1);
+      CHECK(parse(false).borrow().title == "parsed");
+      CHECK(parse(false).take().title == "parsed");
+   }
+   SECTION("a moved from result_box checks its empty box")
+   {
+      const auto title = [](const huge_report& value) {
+         return value.title;
+      };
+
+      result_box<huge_report, int> report = parse(false);
+      const result_box<huge_report, int> moved = std::move(report);
+
+      CHECK(report.is_ok()); // NOLINT
+#if defined(__cpp_exceptions)
+      CHECK_THROWS_AS(report.borrow(), invalid_access_exception);
+      CHECK_THROWS_AS(report.take_or(huge_report{}), invalid_access_exception);
+      CHECK_THROWS_AS(report.transform(title), invalid_access_exception);
+      CHECK_THROWS_AS(std::move(report).take(), invalid_access_exception);
+#endif // defined(__cpp_exceptions)
+      CHECK(moved.borrow().title == "parsed");
+   }
+   SECTION("callables receive the value")
+   {
+      const result_box<std::string, int> title =
+         parse(false).transform([](huge_report&& report) {
+            return std::move(report.title);
+         });
+      const result<std::size_t, int> size =
+         parse(false).and_then([](const huge_report& report) -> result<std::size_t, int> {
+            return ok(report.title.size());
+         });
+      const result_box<std::string, int> error =
+         parse(true).transform([](const huge_report& report) {
+            return report.title;
+         });
+
+      CHECK(title.borrow() == "parsed");
+      CHECK(size.borrow() == 6);
+      CHECK(error.borrow_err() == -1);
+   }
+   SECTION("errors are mapped without reallocating the value")
+   {
+      result_box<huge_report, int> report = parse(false);
+      const huge_report* address = &report.borrow();
+
+      const result_box<huge_report, long> mapped =
+         std::move(report).transform_err([](int code) -> long {
+            return code;
+         });
+
+      CHECK(&mapped.borrow() == address);
+      CHECK(parse(true).transform_err([](int code) -> long {
+                          return code * 2;
+                       }).borrow_err() == -2);
+   }
+   SECTION("or_else and match")
+   {
+      const result_box<huge_report, int> recovered =
+         parse(true).or_else([](int) -> result_box<huge_report, int> {
+            return result_box<huge_report, int>(in_place_ok, huge_report{.title = "recovered"});
+         });
+
+      CHECK(recovered.borrow().title == "recovered");
+      CHECK(recovered.match(
+               [](const huge_report& report) {
+                  return report.title.size();
+               },
+               [](int) {
+                  return std::size_t(0);
+               }) == 9);
+   }
+   SECTION("lvalues are left untouched")
+   {
+      result_box<huge_report, int> report = parse(false);
+      result_box<huge_report, int> error = parse(true);
+
+      const auto recover = [](int) -> result_box<huge_report, int> {
+         return result_box<huge_report, int>(in_place_ok, huge_report{.title = "recovered"});
+      };
+      const auto twice = [](int code) -> long {
+         return code * 2;
+      };
+
+      const result_box<huge_report, long> mapped = report.transform_err(twice);
+      const result_box<huge_report, long> mapped_err = std::as_const(error).transform_err(twice);
+      const result_box<huge_report, int> kept = std::as_const(report).or_else(recover);
+      const result_box<huge_report, int> recovered = error.or_else(recover);
+
+      CHECK(mapped.borrow().title == "parsed");
+      CHECK(&mapped.borrow() != &report.borrow());
+      CHECK(mapped_err.borrow_err() == -2);
+      CHECK(kept.borrow().title == "parsed");
+      CHECK(recovered.borrow().title == "recovered");
+      CHECK(report.borrow().title == "parsed");
+      CHECK(error.borrow_err() == -1);
+   }
+   SECTION("and_then widens the error")
+   {
+      const auto check = [](const huge_report& report) -> result<std::size_t, std::string> {
+         if (report.title.empty())
+         {
+            return err(std::string("untitled"));
+         }
+
+         return ok(report.title.size());
+      };
+
+      const result<std::size_t, error_union<int, std::string>> size = parse(false).and_then(check);
+      const result<std::size_t, error_union<int, std::string>> error = parse(true).and_then(check);
+
+      CHECK(size.borrow() == 6);
+      CHECK(error.borrow_err().holds<int>());
+   }
+   SECTION("join, take_err_or and match with a single callable")
+   {
+      const auto title = [](const huge_report& report) {
+         return report.title;
+      };
+      const auto code = [](int value) {
+         return std::to_string(value);
+      };
+      const overloaded describe{[](const huge_report& report) {
+                                   return report.title;
+                                },
+                                [](int value) {
+                                   return std::to_string(value);
+                                }};
+
+      const result_box<huge_report, int> report = parse(false);
+
+      CHECK(report.join(title, code) == "parsed");
+      CHECK(parse(true).join(title, code) == "-1");
+      CHECK(report.match(describe) == "parsed");
+      CHECK(parse(true).match(describe) == "-1");
+      CHECK(report.take_err_or(0) == 0);
+      CHECK(parse(true).take_err_or(0) == -1);
+
+      result_box<std::string, std::string> same = err(std::string("error"));
+
+      CHECK(std::move(same).join() == "error");
+   }
+   SECTION("comparisons and swap")
+   {
+      result_box<std::string, int> name = ok(std::string("name"));
+      result_box<std::string, int> error = err(3);
+
+      CHECK(name == ok(std::string("name")));
+      CHECK(error == err(3));
+      CHECK(name != error);
+      CHECK(name == result_box<std::string, int>(name));
+
+      std::swap(name, error);
+
+      CHECK(name.borrow_err() == 3);
+      CHECK(error.borrow() == "name");
+   }
+}
+
+TEST_CASE("boxed - pooled storage", "[boxed]")
+{
+   using pool_allocator = std::pmr::polymorphic_allocator<huge_report>;
+
+   std::pmr::unsynchronized_pool_resource pool;
+
+   SECTION("maybe_box")
+   {
+      maybe_box<huge_report, pool_allocator> report{pool_allocator(&pool)};
+
+      CHECK(report.is_none());
+
+      report.emplace(huge_report{.title = "late"});
+
+      REQUIRE(report.is_some());
+      CHECK(report.borrow().title == "late");
+      CHECK(report.get_allocator().resource() == &pool);
+   }
+   SECTION("result_box")
+   {
+      result_box<huge_report, int, pool_allocator> res =
+         ok(allocate_boxed<huge_report>(pool_allocator(&pool), huge_report{.title = "pooled"}));
+
+      REQUIRE(res.is_ok());
+      CHECK(res.borrow().title == "pooled");
+   }
+}
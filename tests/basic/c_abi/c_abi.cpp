@@ -0,0 +1,105 @@
+#include <libreglisse/c_abi.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+using namespace reglisse;
+
+// Defined in engine.c, compiled as C.
+
+extern "C"
+{
+   auto engine_double(reglisse_result_i64_i32 res) -> reglisse_result_i64_i32;
+   auto engine_fail(std::int32_t code) -> reglisse_result_i64_i32;
+   auto engine_half(reglisse_maybe_i32 value) -> reglisse_maybe_i32;
+   auto engine_flip(reglisse_result_i32_i32 res) -> reglisse_result_i32_i32;
+}
+
+namespace
+{
+   struct point
+   {
+      std::int32_t x;
+      std::int32_t y;
+   };
+
+   REGLISSE_MAYBE(c_maybe_point, point);
+   REGLISSE_RESULT(c_result_point_u8, point, std::uint8_t);
+} // namespace
+
+TEST_CASE("c_abi - layouts", "[c_abi]")
+{
+   static_assert(c_layout_of<c_maybe_point, maybe<point>>);
+   static_assert(c_layout_of<c_result_point_u8, result<point, std::uint8_t>>);
+   static_assert(c_layout_of<c_result_point_u8, result<point, std::uint8_t, no_check>>);
+
+   static_assert(not c_layout_of<reglisse_maybe_i32, maybe<std::int64_t>>);
+   static_assert(not c_layout_of<reglisse_maybe_i32, result<std::int32_t, std::int32_t>>);
+   static_assert(not c_layout_of<reglisse_result_i64_i32, result<std::int32_t, std::int64_t>>);
+   static_assert(not c_layout_of<reglisse_result_i32_i32, result<std::int32_t, std::uint32_t>>);
+
+   static_assert(std::same_as<c_abi_type_t<result<std::int64_t, std::int32_t>>,
+                              reglisse_result_i64_i32>);
+}
+
+TEST_CASE("c_abi - conversions by value", "[c_abi]")
+{
+   SECTION("result crosses into C and back")
+   {
+      using result_type = result<std::int64_t, std::int32_t>;
+
+      const result_type value = ok(std::int64_t{21});
+      const result_type error = err(std::int32_t{3});
+
+      CHECK(from_c<result_type>(engine_double(to_c(value))).borrow() == 42);
+      CHECK(from_c<result_type>(engine_double(to_c(error))).borrow_err() == -3);
+      CHECK(from_c<result_type>(engine_fail(7)).borrow_err() == 7);
+   }
+   SECTION("maybe crosses into C and back")
+   {
+      using maybe_type = maybe<std::int32_t>;
+
+      CHECK(from_c<maybe_type>(engine_half(to_c(maybe_type(some(8))))).borrow() == 4);
+      CHECK(from_c<maybe_type>(engine_half(to_c(maybe_type(some(3))))).is_none());
+      CHECK(from_c<maybe_type>(engine_half(to_c(maybe_type(none)))).is_none());
+   }
+   SECTION("same value and error types")
+   {
+      using result_type = result<std::int32_t, std::int32_t>;
+
+      const result_type res = err(std::int32_t{5});
+      const reglisse_result_i32_i32 raw = to_c(res);
+
+      CHECK(not raw.is_ok);
+      CHECK(raw.payload == 5);
+      CHECK(from_c<result_type>(engine_flip(raw)).borrow() == 5);
+   }
+   SECTION("custom structures")
+   {
+      const maybe<point> empty = none;
+      const maybe<point> full = some(point{1, 2});
+
+      CHECK(to_c<c_maybe_point>(empty).is_none);
+      CHECK(to_c<c_maybe_point>(full).value.y == 2);
+
+      const c_maybe_point raw = {.is_none = false, .value = point{3, 4}};
+
+      CHECK(from_c<maybe<point>>(raw).borrow().x == 3);
+
+      const c_result_point_u8 failed = to_c<c_result_point_u8>(
+         result<point, std::uint8_t>(err(std::uint8_t{9})));
+
+      CHECK(from_c<result<point, std::uint8_t>>(failed).borrow_err() == 9);
+   }
+   SECTION("constant evaluation")
+   {
+      constexpr auto round_trip = [](std::int64_t v) {
+         return from_c<result<std::int64_t, std::int32_t>>(
+                   to_c(result<std::int64_t, std::int32_t>(in_place_ok, v)))
+            .borrow();
+      };
+
+      static_assert(round_trip(12) == 12);
+   }
+}
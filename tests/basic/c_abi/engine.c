@@ -0,0 +1,47 @@
+#include <libreglisse/reglisse.h>
+
+/*
+ * Stands in for a C engine, compiled as C and only going through the structures of reglisse.h.
+ */
+
+reglisse_result_i64_i32 engine_double(reglisse_result_i64_i32 res)
+{
+   if (res.is_ok)
+   {
+      res.value *= 2;
+   }
+   else
+   {
+      res.error = -res.error;
+   }
+
+   return res;
+}
+
+reglisse_result_i64_i32 engine_fail(int32_t code)
+{
+   reglisse_result_i64_i32 res = {.is_ok = false, .error = code};
+
+   return res;
+}
+
+reglisse_maybe_i32 engine_half(reglisse_maybe_i32 value)
+{
+   if (!value.is_none && value.value % 2 != 0)
+   {
+      value.is_none = true;
+   }
+   else
+   {
+      value.value /= 2;
+   }
+
+   return value;
+}
+
+reglisse_result_i32_i32 engine_flip(reglisse_result_i32_i32 res)
+{
+   res.is_ok = !res.is_ok;
+
+   return res;
+}
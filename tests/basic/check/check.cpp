@@ -0,0 +1,175 @@
+#include <libreglisse/any_maybe.hpp>
+#include <libreglisse/any_result.hpp>
+#include <libreglisse/boxed.hpp>
+#include <libreglisse/either.hpp>
+#include <libreglisse/error_union.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/maybe_tuple.hpp>
+#include <libreglisse/one_of.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/shared.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   struct counting_check
+   {
+      static inline int failures = 0;
+
+      static constexpr void check(bool valid, const char* /*message*/)
+      {
+         if (not valid)
+         {
+            ++failures;
+         }
+      }
+   };
+
+   constexpr auto sum_checked() -> int
+   {
+      const maybe<int, throw_check> value = some(1);
+      const result<int, int, terminate_check> res = ok(2);
+      const either<int, int, assert_check> side = right(3);
+
+      return value.borrow() + res.borrow() + side.borrow_right();
+   }
+} // namespace
+
+TEST_CASE("check - policies", "[check]")
+{
+   static_assert(check_policy<no_check>);
+   static_assert(check_policy<assert_check>);
+   static_assert(check_policy<terminate_check>);
+   static_assert(check_policy<throw_check>);
+   static_assert(not std::is_same_v<maybe<int, no_check>, maybe<int, throw_check>>);
+
+   SECTION("checks on valid accesses are constant expressions")
+   {
+      static_assert(sum_checked() == 6);
+   }
+#if defined(__cpp_exceptions)
+   SECTION("throw_check throws whatever the global configuration")
+   {
+      const maybe<int, throw_check> empty = none;
+      const result<int, std::string, throw_check> failed = err(std::string("failed"));
+      const either<int, int, throw_check> side = left(1);
+
+      CHECK_THROWS_AS(empty.borrow(), invalid_access_exception);
+      CHECK_THROWS_AS(failed.borrow(), invalid_access_exception);
+      CHECK_THROWS_AS(side.borrow_right(), invalid_access_exception);
+      CHECK(failed.borrow_err() == "failed");
+   }
+#endif // defined(__cpp_exceptions)
+   SECTION("custom policies")
+   {
+      counting_check::failures = 0;
+
+      const either<int, std::string, counting_check> side = left(1);
+
+      CHECK(side.borrow_left() == 1);
+      CHECK(counting_check::failures == 0);
+
+      [[maybe_unused]] const auto& wrong = side.borrow_right();
+
+      CHECK(counting_check::failures == 1);
+   }
+}
+
+TEST_CASE("check - the policy follows transformations", "[check]")
+{
+   const maybe<int, no_check> value = some(2);
+   const result<int, int, throw_check> res = ok(2);
+   const either<int, int, terminate_check> side = left(2);
+
+   const auto doubled = value.transform([](int i) {
+      return i * 2;
+   });
+   const auto message = res.transform([](int i) {
+      return std::to_string(i);
+   });
+   const auto flipped = either<int, int, terminate_check>(side).swap_sides();
+
+   static_assert(std::is_same_v<decltype(doubled), const maybe<int, no_check>>);
+   static_assert(std::is_same_v<decltype(message), const result<std::string, int, throw_check>>);
+   static_assert(std::is_same_v<decltype(flipped), const either<int, int, terminate_check>>);
+
+   CHECK(doubled.borrow() == 4);
+   CHECK(message.borrow() == "2");
+   CHECK(flipped.borrow_right() == 2);
+}
+
+TEST_CASE("check - every checked type takes a policy", "[check]")
+{
+   static_assert(std::is_same_v<one_of<int, float>::check_type, default_check>);
+   static_assert(std::is_same_v<error_union<int, float>::check_type, default_check>);
+   static_assert(std::is_same_v<maybe_tuple<int, float>::check_type, default_check>);
+   static_assert(std::is_same_v<any_maybe::check_type, default_check>);
+   static_assert(std::is_same_v<any_result::check_type, default_check>);
+
+   counting_check::failures = 0;
+
+   SECTION("one_of")
+   {
+      const basic_one_of<counting_check, int, std::string> value = at<0>(1);
+
+      [[maybe_unused]] const auto& wrong = value.borrow<1>();
+
+      CHECK(counting_check::failures == 1);
+   }
+   SECTION("error_union")
+   {
+      const basic_error_union<counting_check, int, std::string> error = 1;
+
+      [[maybe_unused]] const auto& wrong = error.borrow<std::string>();
+
+      CHECK(counting_check::failures == 1);
+   }
+   SECTION("error_union widened by and_then keeps the policy")
+   {
+      const result<int, basic_error_union<counting_check, int, std::string>> res = ok(1);
+
+      const auto chained = res.and_then([](int i) -> result<int, float> {
+         return ok(int(i));
+      });
+
+      static_assert(std::is_same_v<decltype(chained)::error_type::check_type, counting_check>);
+   }
+   SECTION("maybe_tuple")
+   {
+      const basic_maybe_tuple<counting_check, int, std::string> fields;
+
+      [[maybe_unused]] const auto& wrong = fields.get<0>().borrow();
+
+      CHECK(counting_check::failures == 1);
+      static_assert(
+         std::is_same_v<decltype(fields.get<0>().to_maybe()), maybe<int, counting_check>>);
+   }
+   SECTION("any_maybe and any_result")
+   {
+      const basic_any_maybe<counting_check> value = some(1);
+      const basic_any_result<counting_check> error = err(1);
+
+      [[maybe_unused]] const auto& wrong_type = value.borrow<float>();
+      [[maybe_unused]] const auto& wrong_side = error.borrow<int>();
+
+      CHECK(counting_check::failures == 2);
+   }
+#if defined(__cpp_exceptions)
+   SECTION("boxed and shared")
+   {
+      boxed<int, std::allocator<int>, throw_check> box(1);
+      shared<int, local_refcount, throw_check> value(1);
+
+      [[maybe_unused]] const auto moved_box = std::move(box);
+      [[maybe_unused]] const auto moved_value = std::move(value);
+
+      CHECK_THROWS_AS(box.get(), invalid_access_exception);   // NOLINT
+      CHECK_THROWS_AS(value.get(), invalid_access_exception); // NOLINT
+   }
+#endif // defined(__cpp_exceptions)
+}
@@ -0,0 +1,268 @@
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   constexpr auto parse_digit(char c) -> result<int, std::string>
+   {
+      if (c >= '0' and c <= '9')
+      {
+         return ok(c - '0');
+      }
+
+      return err(std::string("not a digit"));
+   }
+
+   constexpr auto half(int value) -> maybe<int>
+   {
+      if (value % 2 == 0)
+      {
+         return some(value / 2);
+      }
+
+      return none;
+   }
+} // namespace
+
+#if defined(__cpp_lib_constexpr_string) && defined(__cpp_lib_constexpr_vector)
+
+// maybe
+
+static_assert([] {
+   maybe<std::string> empty;
+   maybe<std::string> from_none = none;
+   maybe<std::string> full = some(std::string("reglisse"));
+   auto in_place = maybe<std::string>(std::in_place, 3, 'a');
+   auto made = make_maybe<std::vector<int>>(4, 1);
+
+   return empty.is_none() and from_none.is_none() and full.borrow() == "reglisse" and
+      in_place.borrow() == "aaa" and made.borrow().size() == 4;
+}());
+
+static_assert([] {
+   maybe<std::string> lhs = some(std::string("lhs"));
+   maybe<std::string> rhs = none;
+
+   rhs = lhs;
+   const bool copied = rhs.borrow() == "lhs" and lhs.borrow() == "lhs";
+
+   lhs = maybe<std::string>();
+
+   maybe<std::string> moved_to;
+   moved_to = std::move(rhs);
+
+   return copied and lhs.is_none() and moved_to.borrow() == "lhs";
+}());
+
+static_assert([] {
+   maybe<std::vector<int>> lhs = some(std::vector{1, 2, 3});
+   maybe<std::vector<int>> rhs = none;
+
+   lhs.swap(rhs);
+   const bool to_empty = lhs.is_none() and rhs.borrow().size() == 3;
+
+   std::swap(lhs, rhs);
+   const bool from_empty = lhs.borrow().size() == 3 and rhs.is_none();
+
+   rhs.emplace(2, 7);
+   lhs.swap(rhs);
+
+   return to_empty and from_empty and lhs.borrow() == std::vector{7, 7} and
+      rhs.borrow().size() == 3;
+}());
+
+static_assert([] {
+   auto length = maybe<std::string>(some(std::string("four"))).transform(&std::string::size);
+   auto halved = maybe<int>(some(8)).and_then(half).and_then(half).and_then(half);
+   auto odd = maybe<int>(some(3)).and_then(half);
+   auto fallback = maybe<std::string>().or_else([] {
+      return maybe<std::string>(some(std::string("default")));
+   });
+
+   return length.borrow() == 4 and halved.borrow() == 1 and odd.is_none() and
+      fallback.borrow() == "default";
+}());
+
+static_assert([] {
+   maybe<std::string> some_value = some(std::string("a"));
+   maybe<std::string> same_value = some(std::string("a"));
+   maybe<std::string> other_value = some(std::string("b"));
+   maybe<std::string> empty = none;
+
+   return some_value == same_value and some_value != other_value and some_value != empty and
+      empty == none and some_value == std::string("a") and some_value < other_value and
+      empty < some_value;
+}());
+
+// result
+
+static_assert([] {
+   result<std::string, int> value = ok(std::string("value"));
+   result<std::string, int> error = err(3);
+   auto in_place = make_ok<std::vector<int>, std::string>(2, 5);
+   auto in_place_error = make_err<std::vector<int>, std::string>(2, 'e');
+
+   return value.borrow() == "value" and error.borrow_err() == 3 and
+      in_place.borrow() == std::vector{5, 5} and in_place_error.borrow_err() == "ee";
+}());
+
+static_assert([] {
+   result<std::string, std::string> lhs = ok(std::string("ok"));
+   result<std::string, std::string> rhs = err(std::string("err"));
+
+   rhs = lhs;
+   const bool copied = rhs.borrow() == "ok" and lhs.borrow() == "ok";
+
+   lhs = result<std::string, std::string>(err(std::string("moved")));
+   rhs = std::move(lhs);
+
+   return copied and rhs.borrow_err() == "moved";
+}());
+
+static_assert([] {
+   result<std::vector<int>, std::string> lhs = ok(std::vector{1, 2});
+   result<std::vector<int>, std::string> rhs = err(std::string("err"));
+
+   lhs.swap(rhs);
+   const bool swapped = lhs.borrow_err() == "err" and rhs.borrow() == std::vector{1, 2};
+
+   std::swap(lhs, rhs);
+
+   return swapped and lhs.borrow() == std::vector{1, 2} and rhs.borrow_err() == "err";
+}());
+
+static_assert([] {
+   auto digit = parse_digit('7').transform([](int value) {
+      return value * 2;
+   });
+   auto length = parse_digit('x').transform_err(&std::string::size);
+   auto chained = parse_digit('4').and_then([](int value) {
+      return parse_digit(static_cast<char>('0' + value + 1));
+   });
+   auto recovered = parse_digit('x').or_else([](const std::string& error) {
+      return result<int, std::string>(ok(static_cast<int>(error.size())));
+   });
+
+   return digit.borrow() == 14 and length.borrow_err() == 11 and chained.borrow() == 5 and
+      recovered.borrow() == 11;
+}());
+
+static_assert([] {
+   auto value = parse_digit('1');
+   auto same_value = parse_digit('1');
+   auto error = parse_digit('x');
+
+   return value == same_value and value != error and error == parse_digit('y') and
+      value == ok(1) and error == err(std::string("not a digit")) and value != ok(2);
+}());
+
+// either
+
+static_assert([] {
+   either<std::string, std::vector<int>> left_value = left(std::string("left"));
+   either<std::string, std::vector<int>> right_value = right(std::vector{1, 2, 3});
+   auto in_place = make_left<std::string, int>(2, 'l');
+   auto in_place_right = make_right<std::string, std::vector<int>>(1, 9);
+
+   return left_value.borrow_left() == "left" and right_value.borrow_right().size() == 3 and
+      in_place.borrow_left() == "ll" and in_place_right.borrow_right() == std::vector{9};
+}());
+
+static_assert([] {
+   either<std::string, int> lhs = left(std::string("left"));
+   either<std::string, int> rhs = right(2);
+
+   rhs = lhs;
+   const bool copied = rhs.borrow_left() == "left" and lhs.borrow_left() == "left";
+
+   lhs = either<std::string, int>(right(3));
+   rhs = std::move(lhs);
+
+   return copied and rhs.borrow_right() == 3;
+}());
+
+static_assert([] {
+   either<std::string, std::vector<int>> lhs = left(std::string("left"));
+   either<std::string, std::vector<int>> rhs = right(std::vector{4});
+
+   lhs.swap(rhs);
+   const bool swapped = lhs.borrow_right() == std::vector{4} and rhs.borrow_left() == "left";
+
+   std::swap(lhs, rhs);
+
+   return swapped and lhs.borrow_left() == "left" and rhs.borrow_right() == std::vector{4};
+}());
+
+static_assert([] {
+   using either_type = either<std::string, int>;
+
+   auto length = either_type(left(std::string("four"))).transform_left(&std::string::size);
+   auto doubled = either_type(right(4)).transform_right([](int value) {
+      return value * 2;
+   });
+   auto chained = either_type(left(std::string("chain"))).flat_transform_left([](std::string s) {
+      return either_type(right(static_cast<int>(s.size())));
+   });
+   auto recovered = either_type(right(2)).flat_transform_right([](int value) {
+      return either_type(left(std::string(static_cast<std::size_t>(value), 'r')));
+   });
+
+   return length.borrow_left() == 4 and doubled.borrow_right() == 8 and
+      chained.borrow_right() == 5 and recovered.borrow_left() == "rr";
+}());
+
+static_assert([] {
+   either<std::string, int> lhs = left(std::string("a"));
+   either<std::string, int> same = left(std::string("a"));
+   either<std::string, int> rhs = right(1);
+
+   return lhs == same and lhs != rhs and rhs == right(1) and lhs == left(std::string("a")) and
+      rhs != left(std::string("a"));
+}());
+
+#endif // defined(__cpp_lib_constexpr_string) && defined(__cpp_lib_constexpr_vector)
+
+// Lookup tables folded at build time from trivial payloads.
+
+static_assert([] {
+   int sum = 0;
+   for (char c : {'1', '2', 'x', '3'})
+   {
+      sum += parse_digit(c).take_or(0);
+   }
+
+   return sum == 6;
+}());
+
+TEST_CASE("constexpr", "[constexpr]")
+{
+   constexpr auto table = [] {
+      struct entry
+      {
+         maybe<int> halved;
+         bool digit;
+      };
+
+      std::array<entry, 4> values{};
+      for (int i = 0; i < 4; ++i)
+      {
+         values[static_cast<std::size_t>(i)] = {half(i), parse_digit(char('0' + i)).is_ok()};
+      }
+
+      return values;
+   }();
+
+   CHECK(table[0].halved == 0);
+   CHECK(table[1].halved == none);
+   CHECK(table[2].halved == 1);
+   CHECK(table[3].digit);
+}
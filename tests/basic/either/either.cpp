@@ -1,10 +1,18 @@
+#include "../move_counter.hpp"
+
 #include <libreglisse/either.hpp>
+#include <libreglisse/match.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 using namespace reglisse;
+using test::move_counter;
 
 SCENARIO("either - constructor", "[either]")
 {
@@ -144,3 +152,348 @@ SCENARIO("either - borrowing", "[either]") {}
 SCENARIO("either - taking", "[either]") {}
 
 SCENARIO("either - transforming the data", "[either]") {}
+
+TEST_CASE("either - match", "[either]")
+{
+   const auto describe = overloaded{[](int val) {
+                                       return std::to_string(val);
+                                    },
+                                    [](const std::string& str) {
+                                       return str;
+                                    }};
+
+   SECTION("match(fun&&) const&")
+   {
+      const either<int, std::string> left_val = left(1);
+      const either<int, std::string> right_val = right(std::string("hello"));
+
+      CHECK(match(left_val, describe) == "1");
+      CHECK(match(right_val, describe) == "hello");
+   }
+   SECTION("match(left_fun&&, right_fun&&) &")
+   {
+      either<int, int> val = right(1);
+
+      match(
+         val,
+         [](int& left_val) {
+            left_val = 0;
+         },
+         [](int& right_val) {
+            right_val += 1;
+         });
+
+      REQUIRE(val.is_right());
+      CHECK(val.borrow_right() == 2);
+   }
+   SECTION("match(left_fun&&, right_fun&&) &&")
+   {
+      const std::size_t size = either<std::vector<int>, int>(left(std::vector({1, 1}))).match(
+         [](std::vector<int>&& vec) {
+            return std::size(vec);
+         },
+         [](int&&) {
+            return std::size_t{0};
+         });
+
+      CHECK(size == 2);
+   }
+}
+
+TEST_CASE("either - in place construction", "[either]")
+{
+   SECTION("in_place_left and in_place_right constructors")
+   {
+      const either<move_counter, int> lhs(in_place_left, 1, 2);
+      const either<int, move_counter> rhs(in_place_right, 3, 4);
+
+      REQUIRE(lhs.is_left());
+      CHECK(lhs.borrow_left().first == 1);
+      CHECK(lhs.borrow_left().moves == 0);
+
+      REQUIRE(rhs.is_right());
+      CHECK(rhs.borrow_right().second == 4);
+      CHECK(rhs.borrow_right().moves == 0);
+   }
+   SECTION("make_left and make_right")
+   {
+      const auto lhs = make_left<move_counter, int>(1, 2);
+      const auto rhs = make_right<int, move_counter>(3, 4);
+
+      REQUIRE(lhs.is_left());
+      CHECK(lhs.borrow_left().moves == 0);
+
+      REQUIRE(rhs.is_right());
+      CHECK(rhs.borrow_right().moves == 0);
+   }
+   SECTION("emplace_left and emplace_right")
+   {
+      either<move_counter, std::vector<int>> val = right(std::vector<int>());
+
+      move_counter& inner = val.emplace_left(5, 6);
+
+      REQUIRE(val.is_left());
+      CHECK(&inner == &val.borrow_left());
+      CHECK(inner.moves == 0);
+
+      val.emplace_right(3, 1);
+
+      REQUIRE(val.is_right());
+      CHECK(val.borrow_right() == std::vector({1, 1, 1}));
+   }
+}
+
+TEST_CASE("either - non consuming operations", "[either]")
+{
+   struct config
+   {
+      std::string name;
+      std::vector<int> ports;
+   };
+
+   const either<config, std::string> cached = left(config{.name = "server", .ports = {80, 443}});
+   const either<config, std::string> message = right(std::string("hello"));
+
+   SECTION("transform_left(fun&&) const&")
+   {
+      const either<std::string, std::string> name = cached.transform_left(&config::name);
+
+      REQUIRE(name.is_left());
+      CHECK(name.borrow_left() == "server");
+      CHECK(cached.borrow_left().name == "server");
+   }
+   SECTION("transform_right(fun&&) const&")
+   {
+      const auto length = message.transform_right([](const std::string& str) {
+         return str.size();
+      });
+
+      CHECK(length.borrow_right() == 5);
+      CHECK(message.borrow_right() == "hello");
+   }
+   SECTION("transform_left(fun&&) &")
+   {
+      either<config, std::string> val = left(config{.name = "server", .ports = {80}});
+
+      const auto count = val.transform_left([](config& c) {
+         c.ports.push_back(443);
+         return c.ports.size();
+      });
+
+      CHECK(count.borrow_left() == 2);
+      CHECK(val.borrow_left().ports.size() == 2);
+   }
+   SECTION("flat_transform_left(fun&&) const&")
+   {
+      const auto port = cached.flat_transform_left([](const config& c) -> either<int, std::string> {
+         return left(int(c.ports.back()));
+      });
+
+      CHECK(port.borrow_left() == 443);
+   }
+   SECTION("flat_transform_right(fun&&) const&")
+   {
+      const auto res = message.flat_transform_right([](const std::string& str) {
+         return either<config, std::string>(right(str + "!"));
+      });
+
+      CHECK(res.borrow_right() == "hello!");
+      CHECK(message.borrow_right() == "hello");
+   }
+}
+
+TEST_CASE("either - transform constructs the new value in place", "[either]")
+{
+   const auto next = [](const move_counter& c) {
+      return move_counter(c.first + 1, c.second);
+   };
+
+   SECTION("transform_left(fun&&) &&")
+   {
+      const auto val =
+         either<move_counter, int>(in_place_left, 1, 2).transform_left(next).transform_left(next);
+
+      REQUIRE(val.is_left());
+      CHECK(val.borrow_left().first == 3);
+      CHECK(val.borrow_left().moves == 0);
+   }
+   SECTION("transform_right(fun&&) &&")
+   {
+      const auto val = either<int, move_counter>(in_place_right, 1, 2)
+                          .transform_right(next)
+                          .transform_right(next);
+
+      REQUIRE(val.is_right());
+      CHECK(val.borrow_right().first == 3);
+      CHECK(val.borrow_right().moves == 0);
+   }
+   SECTION("transform_left(fun&&) && forwards the right value with a single move")
+   {
+      const auto val = either<int, move_counter>(in_place_right, 1, 2).transform_left([](int i) {
+         return i + 1;
+      });
+
+      REQUIRE(val.is_right());
+      CHECK(val.borrow_right().moves == 1);
+   }
+}
+
+TEST_CASE("either - immovable values", "[either]")
+{
+   static_assert(not std::is_copy_constructible_v<either<std::mutex, int>>);
+   static_assert(not std::is_move_constructible_v<either<int, std::mutex>>);
+
+   either<std::mutex, int> val(in_place_right, 1);
+
+   REQUIRE(val.is_right());
+
+   val.emplace_left();
+
+   REQUIRE(val.is_left());
+   CHECK(val.borrow_left().try_lock());
+   val.borrow_left().unlock();
+}
+
+TEST_CASE("either - same type on both sides", "[either]")
+{
+   static_assert(sizeof(either<std::uint64_t, std::uint64_t>) == 2 * sizeof(std::uint64_t));
+   static_assert(std::is_trivially_copyable_v<either<int, int>>);
+
+   SECTION("copies keep the side")
+   {
+      const either<std::string, std::string> primary = left(std::string("primary"));
+      const either<std::string, std::string> fallback = right(std::string("fallback"));
+
+      const auto primary_copy = primary; // NOLINT
+      const auto fallback_copy = fallback; // NOLINT
+
+      CHECK(primary_copy.borrow_left() == "primary");
+      CHECK(fallback_copy.borrow_right() == "fallback");
+   }
+   SECTION("swap_sides")
+   {
+      const auto val = either<move_counter, move_counter>(in_place_left, 1, 2).swap_sides();
+
+      REQUIRE(val.is_right());
+      CHECK(val.borrow_right().first == 1);
+      CHECK(val.borrow_right().moves == 1);
+
+      const either<int, std::string> mixed = right(std::string("mixed"));
+
+      CHECK(either<int, std::string>(mixed).swap_sides().borrow_left() == "mixed");
+
+      either<move_counter, move_counter> in_place(in_place_left, 3, 4);
+
+      in_place.swap_sides();
+
+      REQUIRE(in_place.is_right());
+      CHECK(in_place.borrow_right().first == 3);
+      CHECK(in_place.borrow_right().moves == 0);
+
+      in_place.swap_sides();
+
+      REQUIRE(in_place.is_left());
+      CHECK(in_place.borrow_left().moves == 0);
+   }
+   SECTION("join")
+   {
+      either<std::string, std::string> found = right(std::string("fallback"));
+
+      CHECK(found.join() == "fallback");
+
+      found.emplace_left("primary");
+
+      CHECK(std::move(found).join() == "primary");
+   }
+}
+
+#if defined(__cpp_exceptions)
+namespace
+{
+   /**
+    * @brief A payload whose construction fails on request, counting the live instances.
+    */
+   struct fragile
+   {
+      static inline int live = 0;
+
+      explicit fragile(bool fail)
+      {
+         if (fail)
+         {
+            throw std::runtime_error("fragile");
+         }
+
+         ++live;
+      }
+      fragile(const fragile&) { ++live; }
+      fragile(fragile&&) noexcept { ++live; }
+      ~fragile() { --live; }
+
+      auto operator=(const fragile&) -> fragile& = default;
+      auto operator=(fragile&&) noexcept -> fragile& = default;
+   };
+} // namespace
+
+TEST_CASE("either - emplace leaves the value intact when construction throws", "[either]")
+{
+   SECTION("distinct sides")
+   {
+      {
+         either<fragile, std::string> value = right(std::string("held"));
+
+         CHECK_THROWS_AS(value.emplace_left(true), std::runtime_error);
+         REQUIRE(value.is_right());
+         CHECK(value.borrow_right() == "held");
+
+         value.emplace_left(false);
+
+         CHECK_THROWS_AS(value.emplace_left(true), std::runtime_error);
+         CHECK(value.is_left());
+         CHECK(fragile::live == 1);
+      }
+
+      CHECK(fragile::live == 0);
+   }
+   SECTION("same type on both sides")
+   {
+      {
+         either<fragile, fragile> value(in_place_left, false);
+
+         CHECK_THROWS_AS(value.emplace_right(true), std::runtime_error);
+         CHECK(value.is_left());
+         CHECK(fragile::live == 1);
+      }
+
+      CHECK(fragile::live == 0);
+   }
+}
+#endif // defined(__cpp_exceptions)
+
+TEST_CASE("either - moves are noexcept when both sides are", "[either]")
+{
+   struct throwing_move
+   {
+      throwing_move() = default;
+      throwing_move(const throwing_move&) = default;
+      throwing_move(throwing_move&&) noexcept(false) {}
+      ~throwing_move() = default;
+
+      auto operator=(const throwing_move&) -> throwing_move& = default;
+      auto operator=(throwing_move&&) noexcept(false) -> throwing_move& { return *this; }
+   };
+
+   static_assert(std::is_nothrow_move_constructible_v<either<int, std::string>>);
+   static_assert(std::is_nothrow_move_assignable_v<either<int, std::string>>);
+   static_assert(std::is_nothrow_move_constructible_v<either<std::string, std::string>>);
+
+   static_assert(not std::is_nothrow_move_constructible_v<either<int, throwing_move>>);
+   static_assert(not std::is_nothrow_move_assignable_v<either<throwing_move, int>>);
+   static_assert(not std::is_nothrow_move_constructible_v<either<throwing_move, throwing_move>>);
+   static_assert(not std::is_nothrow_move_assignable_v<either<throwing_move, throwing_move>>);
+
+   either<int, throwing_move> value = right(throwing_move());
+   either<int, throwing_move> moved = std::move(value);
+
+   CHECK(moved.is_right());
+}
@@ -0,0 +1,88 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <functional>
+#include <string>
+
+namespace
+{
+   struct probe
+   {
+      int key;
+   };
+
+   struct parsed
+   {
+      int value;
+   };
+} // namespace
+
+template <class Check>
+struct reglisse::expected_outcome<reglisse::maybe<probe, Check>> : reglisse::failure_is_likely
+{
+};
+
+template <class Error, class Check>
+struct reglisse::expected_outcome<reglisse::result<parsed, Error, Check>> :
+   reglisse::success_is_likely
+{
+};
+
+using namespace reglisse;
+
+namespace
+{
+   constexpr auto parse(int value) -> result<parsed, int>
+   {
+      if (value < 0)
+      {
+         return err(int(value));
+      }
+
+      return ok(parsed{value});
+   }
+} // namespace
+
+TEST_CASE("likelihood - expected outcome", "[likelihood]")
+{
+   static_assert(expected_outcome_v<maybe<int>> == outcome_likelihood::unknown);
+   static_assert(expected_outcome_v<maybe<probe>> == outcome_likelihood::failure_likely);
+   static_assert(expected_outcome_v<maybe<probe, no_check>> == outcome_likelihood::failure_likely);
+   static_assert(expected_outcome_v<result<parsed, int>> == outcome_likelihood::success_likely);
+   static_assert(expected_outcome_v<result<int, parsed>> == outcome_likelihood::unknown);
+
+   SECTION("hints do not change the outcome")
+   {
+      constexpr auto value_of = [](parsed p) {
+         return p.value;
+      };
+
+      static_assert(parse(1).transform(value_of).take_or(0) == 1);
+      static_assert(parse(-1).transform(value_of).take_or(0) == 0);
+      static_assert(parse(2).join(value_of, std::identity()) == 2);
+      static_assert(parse(-2).join(value_of, std::identity()) == -2);
+
+      const maybe<probe> hit = some(probe{3});
+      const maybe<probe> miss = none;
+
+      CHECK(hit.transform(&probe::key).take_or(0) == 3);
+      CHECK(miss.transform(&probe::key).take_or(0) == 0);
+      CHECK(maybe<probe>(none).or_else([] { return maybe<probe>(some(probe{4})); })
+               .take_or(probe{0})
+               .key == 4);
+      CHECK(miss.and_then([](const probe& p) { return maybe<int>(some(int(p.key))); }).is_none());
+   }
+   SECTION("take_err_or")
+   {
+      CHECK(parse(-5).take_err_or(0) == -5);
+      CHECK(parse(5).take_err_or(0) == 0);
+
+      const result<parsed, std::string> failed = err(std::string("failed"));
+      const result<parsed, std::string> passed = ok(parsed{1});
+
+      CHECK(std::move(failed).take_err_or("none") == "failed");
+      CHECK(std::move(passed).take_err_or("none") == "none");
+   }
+}
@@ -0,0 +1,74 @@
+#include <libreglisse/any_maybe.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   using large = std::array<std::uint64_t, 8>; // NOLINT
+} // namespace
+
+TEST_CASE("any_maybe", "[maybe]")
+{
+   static_assert(not std::copy_constructible<any_maybe>);
+   static_assert(std::move_constructible<any_maybe>);
+
+   SECTION("erases and restores the value type")
+   {
+      any_maybe value = maybe<std::string>(some(std::string("reglisse")));
+      any_maybe empty = maybe<int>();
+
+      CHECK(value.is_some());
+      CHECK(value.holds<std::string>());
+      CHECK(not value.holds<int>());
+      CHECK(value.type() == typeid(std::string));
+      CHECK(empty.is_none());
+      CHECK(empty.type() == typeid(void));
+
+      CHECK(std::move(value).to_maybe<std::string>().borrow() == "reglisse");
+      CHECK(std::move(empty).to_maybe<int>().is_none());
+   }
+   SECTION("large and move only values")
+   {
+      any_maybe big{std::in_place_type<large>, large{1, 2, 3}};
+      any_maybe unique = some(std::make_unique<int>(4));
+
+      CHECK(big.borrow<large>()[2] == 3);
+
+      any_maybe moved = std::move(unique);
+      CHECK(*moved.borrow<std::unique_ptr<int>>() == 4);
+
+      moved = std::move(big);
+      CHECK(moved.holds<large>());
+      CHECK(std::move(moved).take<large>()[0] == 1);
+   }
+   SECTION("monadic operations")
+   {
+      const auto length = any_maybe(some(std::string("four")))
+                             .transform<std::string>(&std::string::size)
+                             .take_or<std::size_t>(0U);
+
+      CHECK(length == 4);
+      CHECK(any_maybe(none).transform<std::string>(&std::string::size).is_none());
+
+      auto halve = [](int i) -> maybe<int> {
+         if (i % 2 == 0)
+         {
+            return some(int(i / 2));
+         }
+
+         return none;
+      };
+
+      CHECK(any_maybe(some(4)).and_then<int>(halve).borrow<int>() == 2);
+      CHECK(any_maybe(some(3)).and_then<int>(halve).is_none());
+      CHECK(any_maybe(none).or_else([] { return any_maybe(some(1)); }).borrow<int>() == 1);
+      CHECK(any_maybe(some(2)).match<int>([](int i) { return i; }, [] { return 0; }) == 2);
+   }
+}
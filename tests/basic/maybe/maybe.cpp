@@ -1,9 +1,21 @@
 #define LIBREGLISSE_USE_EXCEPTIONS
+#include "../move_counter.hpp"
+
 #include <libreglisse/maybe.hpp>
+#include <libreglisse/match.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 using namespace reglisse;
+using test::move_counter;
 
 SCENARIO("maybe - construction", "[maybe]")
 {
@@ -156,6 +168,80 @@ TEST_CASE("maybe - move assignment operator", "[maybe]")
    CHECK(maybe_none.is_none());
 }
 
+#if defined(__cpp_exceptions)
+namespace
+{
+   /**
+    * @brief A value whose copies fail on request, counting the live instances.
+    */
+   struct fragile_value
+   {
+      static inline int live = 0;
+
+      explicit fragile_value(bool fail_copy) : fail_copy(fail_copy) { ++live; }
+      fragile_value(const fragile_value& other) : fail_copy(other.fail_copy)
+      {
+         if (fail_copy)
+         {
+            throw std::runtime_error("copy");
+         }
+
+         ++live;
+      }
+      fragile_value(fragile_value&& other) noexcept : fail_copy(other.fail_copy) { ++live; }
+      ~fragile_value() { --live; }
+
+      auto operator=(const fragile_value&) -> fragile_value& = default;
+      auto operator=(fragile_value&&) noexcept -> fragile_value& = default;
+
+      bool fail_copy;
+   };
+} // namespace
+
+TEST_CASE("maybe - copy assignment is left empty when the copy throws", "[maybe]")
+{
+   {
+      const maybe<fragile_value> failing(std::in_place, true);
+      maybe<fragile_value> target(std::in_place, false);
+
+      CHECK_THROWS_AS(target = failing, std::runtime_error);
+      CHECK(target.is_none());
+      CHECK(fragile_value::live == 1);
+
+      target = maybe<fragile_value>(std::in_place, false);
+
+      CHECK(target.is_some());
+      CHECK(fragile_value::live == 2);
+   }
+
+   CHECK(fragile_value::live == 0);
+}
+#endif // defined(__cpp_exceptions)
+
+TEST_CASE("maybe - move operations are noexcept when the value's are", "[maybe]")
+{
+   struct throwing_move
+   {
+      throwing_move() = default;
+      throwing_move(const throwing_move&) = default;
+      throwing_move(throwing_move&&) noexcept(false) {}
+      ~throwing_move() = default;
+
+      auto operator=(const throwing_move&) -> throwing_move& = default;
+      auto operator=(throwing_move&&) noexcept(false) -> throwing_move& { return *this; }
+   };
+
+   static_assert(std::is_nothrow_move_constructible_v<maybe<std::string>>);
+   static_assert(std::is_nothrow_move_assignable_v<maybe<std::string>>);
+   static_assert(not std::is_nothrow_move_constructible_v<maybe<throwing_move>>);
+   static_assert(not std::is_nothrow_move_assignable_v<maybe<throwing_move>>);
+
+   maybe<throwing_move> value(std::in_place);
+   maybe<throwing_move> moved = std::move(value);
+
+   CHECK(moved.is_some());
+}
+
 SCENARIO("maybe - borrowing data", "[maybe]")
 {
    GIVEN("a maybe holding data")
@@ -179,10 +265,11 @@ SCENARIO("maybe - borrowing data", "[maybe]")
       THEN("Maybe should be empty and throw exception on access")
       {
          CHECK(data.is_none());
-         CHECK_THROWS_AS(data.borrow() == 1, invalid_access_exception);
-
          CHECK(maybe_vec.is_none());
+#if defined(__cpp_exceptions)
+         CHECK_THROWS_AS(data.borrow() == 1, invalid_access_exception);
          CHECK_THROWS_AS(maybe_vec.borrow() == std::vector({1, 1}), invalid_access_exception);
+#endif // defined(__cpp_exceptions)
       }
    }
 }
@@ -204,6 +291,7 @@ SCENARIO("maybe - taking data", "[maybe]")
          CHECK(std::move(maybe_vec).take() == std::vector({1, 1}));
       }
    }
+#if defined(__cpp_exceptions)
    GIVEN("an empty maybe")
    {
       maybe<int> maybe_int = none;
@@ -219,6 +307,7 @@ SCENARIO("maybe - taking data", "[maybe]")
          CHECK_THROWS(std::move(maybe_str).take() == "hello");
       }
    }
+#endif // defined(__cpp_exceptions)
 }
 
 TEST_CASE("maybe - take_or(U)", "[maybe]")
@@ -894,3 +983,243 @@ TEST_CASE("maybe - comparison", "[maybe]")
       }
    }
 }
+
+TEST_CASE("maybe - match", "[maybe]")
+{
+   const auto describe = overloaded{[](const std::vector<int>& vec) {
+                                       return std::size(vec);
+                                    },
+                                    [](none_t) {
+                                       return std::size_t{0};
+                                    }};
+
+   SECTION("match(fun&&) const&")
+   {
+      const maybe maybe_vec = some(std::vector({1, 1, 1}));
+      const maybe<std::vector<int>> maybe_none = none;
+
+      CHECK(match(maybe_vec, describe) == 3);
+      CHECK(match(maybe_none, describe) == 0);
+   }
+   SECTION("match(fun&&) &")
+   {
+      maybe maybe_int = some(1);
+
+      match(
+         maybe_int,
+         [](int& val) {
+            val += 1;
+         },
+         [] {
+         });
+
+      REQUIRE(maybe_int.is_some());
+      CHECK(maybe_int.borrow() == 2);
+   }
+   SECTION("match(fun&&) &&")
+   {
+      std::vector<int> stolen;
+
+      match(
+         maybe(some(std::vector({1, 1}))),
+         [&](std::vector<int>&& vec) {
+            stolen = std::move(vec);
+         },
+         [] {
+         });
+
+      CHECK(stolen == std::vector({1, 1}));
+
+      const int res = maybe<int>(none).match(
+         [](int val) {
+            return val;
+         },
+         [] {
+            return -1;
+         });
+
+      CHECK(res == -1);
+   }
+}
+
+TEST_CASE("maybe - in place construction", "[maybe]")
+{
+   SECTION("std::in_place constructor")
+   {
+      const maybe<move_counter> val(std::in_place, 1, 2);
+
+      REQUIRE(val.is_some());
+      CHECK(val.borrow().first == 1);
+      CHECK(val.borrow().second == 2);
+      CHECK(val.borrow().moves == 0);
+   }
+   SECTION("make_maybe")
+   {
+      const auto val = make_maybe<move_counter>(3, 4);
+
+      REQUIRE(val.is_some());
+      CHECK(val.borrow().first == 3);
+      CHECK(val.borrow().moves == 0);
+   }
+   SECTION("emplace")
+   {
+      maybe<move_counter> val = none;
+
+      move_counter& inner = val.emplace(5, 6);
+
+      REQUIRE(val.is_some());
+      CHECK(&inner == &val.borrow());
+      CHECK(inner.second == 6);
+      CHECK(inner.moves == 0);
+
+      val.emplace(7, 8);
+
+      CHECK(val.borrow().first == 7);
+      CHECK(val.borrow().moves == 0);
+   }
+}
+
+TEST_CASE("maybe - non consuming operations", "[maybe]")
+{
+   struct config
+   {
+      std::string name;
+      std::vector<int> ports;
+   };
+
+   const maybe<config> cached = some(config{.name = "server", .ports = {80, 443}});
+
+   SECTION("transform(fun&&) const&")
+   {
+      const maybe<std::string> name = cached.transform(&config::name);
+
+      REQUIRE(name.is_some());
+      CHECK(name.borrow() == "server");
+      CHECK(cached.borrow().name == "server");
+   }
+   SECTION("transform(fun&&) &")
+   {
+      maybe<config> val = some(config{.name = "server", .ports = {80}});
+
+      const maybe<std::size_t> count = val.transform([](config& c) {
+         c.ports.push_back(443);
+         return c.ports.size();
+      });
+
+      CHECK(count.borrow() == 2);
+      CHECK(val.borrow().ports.size() == 2);
+   }
+   SECTION("transform_or(fun&&, other&&) const&")
+   {
+      CHECK(cached.transform_or(
+               [](const config& c) {
+                  return c.ports.size();
+               },
+               0U) == 2U);
+   }
+   SECTION("and_then(fun&&) const&")
+   {
+      const maybe<int> first_port = cached.and_then([](const config& c) -> maybe<int> {
+         if (c.ports.empty())
+         {
+            return none;
+         }
+
+         return some(int(c.ports.front()));
+      });
+
+      CHECK(first_port.borrow() == 80);
+   }
+   SECTION("or_else(fun&&) const&")
+   {
+      const maybe<config> empty = none;
+
+      CHECK(cached.or_else([] {
+                     return maybe<config>(none);
+                  })
+               .is_some());
+      CHECK(empty
+               .or_else([] {
+                  return maybe(some(config{.name = "default", .ports = {}}));
+               })
+               .borrow()
+               .name == "default");
+   }
+   SECTION("transform_or_else(fun&&, def&&) const&")
+   {
+      const std::string name = cached.transform_or_else(
+         [](const config& c) {
+            return c.name;
+         },
+         [] {
+            return std::string("none");
+         });
+
+      CHECK(name == "server");
+   }
+}
+
+TEST_CASE("maybe - transform constructs the new value in place", "[maybe]")
+{
+   const auto next = [](const move_counter& c) {
+      return move_counter(c.first + 1, c.second);
+   };
+
+   SECTION("transform(fun&&) &&")
+   {
+      const auto val =
+         maybe<move_counter>(std::in_place, 1, 2).transform(next).transform(next).transform(next);
+
+      REQUIRE(val.is_some());
+      CHECK(val.borrow().first == 4);
+      CHECK(val.borrow().moves == 0);
+   }
+   SECTION("transform(fun&&) const&")
+   {
+      const maybe<move_counter> cached(std::in_place, 1, 2);
+
+      const auto val = cached.transform(next);
+
+      REQUIRE(val.is_some());
+      CHECK(val.borrow().first == 2);
+      CHECK(val.borrow().moves == 0);
+   }
+}
+
+TEST_CASE("maybe - immovable values", "[maybe]")
+{
+   static_assert(not std::is_copy_constructible_v<maybe<std::mutex>>);
+   static_assert(not std::is_move_constructible_v<maybe<std::mutex>>);
+   static_assert(not std::is_move_assignable_v<maybe<std::mutex>>);
+
+   SECTION("std::in_place constructor")
+   {
+      maybe<std::atomic<std::uint64_t>> counter(std::in_place, 41U);
+
+      REQUIRE(counter.is_some());
+      counter.borrow().fetch_add(1);
+      CHECK(counter.borrow().load() == 42U);
+
+      const maybe<std::uint64_t> value = counter.transform([](std::atomic<std::uint64_t>& c) {
+         return c.load();
+      });
+
+      CHECK(value.borrow() == 42U);
+   }
+   SECTION("emplace")
+   {
+      maybe<std::mutex> lock;
+
+      REQUIRE(lock.is_none());
+
+      lock.emplace();
+
+      REQUIRE(lock.is_some());
+      CHECK(lock.borrow().try_lock());
+      lock.borrow().unlock();
+
+      lock.reset();
+
+      CHECK(lock.is_none());
+   }
+}
@@ -0,0 +1,210 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#include <libreglisse/maybe_tuple.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   // id, name, score, retries
+   using record = maybe_tuple<std::uint32_t, std::string, double, std::uint16_t>;
+
+   struct unpacked_record
+   {
+      maybe<std::uint32_t> id;
+      maybe<std::string> name;
+      maybe<double> score;
+      maybe<std::uint16_t> retries;
+   };
+} // namespace
+
+TEST_CASE("maybe_tuple - layout", "[maybe_tuple]")
+{
+   static_assert(std::is_same_v<record::mask_type, std::uint8_t>);
+   static_assert(std::is_same_v<maybe_tuple<bool, bool, bool, bool, bool, bool, bool, bool,
+                                            bool>::mask_type,
+                                std::uint16_t>);
+   static_assert(sizeof(record) < sizeof(unpacked_record));
+   static_assert(record::mask_of<0, 2> == 0b101);
+}
+
+TEST_CASE("maybe_tuple - fields", "[maybe_tuple]")
+{
+   SECTION("default construction")
+   {
+      const record rec;
+
+      CHECK(rec.mask() == 0);
+      CHECK(rec.is_none<0>());
+      CHECK(rec.get<1>().is_none());
+      CHECK(rec.get<1>().take_or("anonymous") == "anonymous");
+   }
+   SECTION("construction from maybe")
+   {
+      const record rec(some(42U), some(std::string("probe")), none, some<std::uint16_t>(3));
+
+      CHECK(rec.mask() == 0b1011);
+      CHECK(rec.get<0>().borrow() == 42);
+      CHECK(rec.get<1>().borrow() == "probe");
+      CHECK(rec.get<2>().is_none());
+#if defined(__cpp_exceptions)
+      CHECK_THROWS_AS(rec.get<2>().borrow(), invalid_access_exception);
+#endif // defined(__cpp_exceptions)
+   }
+   SECTION("emplace and reset")
+   {
+      record rec;
+
+      rec.emplace<1>(3, 'a');
+      rec.get<2>().emplace(0.5);
+
+      CHECK(rec.get<1>().borrow() == "aaa");
+      CHECK(rec.mask() == record::mask_of<1, 2>);
+
+      rec.reset<1>();
+
+      CHECK(rec.is_none<1>());
+      CHECK(rec.mask() == record::mask_of<2>);
+   }
+   SECTION("maybe interface")
+   {
+      record rec;
+      rec.emplace<1>("probe");
+
+      const maybe<std::size_t> length = rec.get<1>().transform(&std::string::size);
+      const maybe<std::uint32_t> id = rec.get<0>().transform([](std::uint32_t i) {
+         return i + 1;
+      });
+
+      CHECK(length.borrow() == 5);
+      CHECK(id.is_none());
+      CHECK(rec.get<1>().match(
+         [](const std::string& name) {
+            return name;
+         },
+         [] {
+            return std::string("anonymous");
+         }) == "probe");
+      CHECK(rec.get<1>().to_maybe().borrow() == "probe");
+      CHECK(rec.get<1>()
+               .and_then([](const std::string& name) {
+                  return name.empty() ? maybe<char>(none) : some(char(name.front()));
+               })
+               .borrow() == 'p');
+   }
+}
+
+TEST_CASE("maybe_tuple - value semantics", "[maybe_tuple]")
+{
+   record rec(none, some(std::string("original")), some(1.0), none);
+
+   SECTION("copies only present fields")
+   {
+      record copy = rec;
+      copy.get<1>().borrow() += " copy";
+
+      CHECK(copy.mask() == rec.mask());
+      CHECK(rec.get<1>().borrow() == "original");
+      CHECK(copy.get<1>().borrow() == "original copy");
+   }
+   SECTION("moves")
+   {
+      record other;
+      other.emplace<0>(7U);
+
+      other = std::move(rec);
+
+      CHECK(other.mask() == record::mask_of<1, 2>);
+      CHECK(other.get<1>().take() == "original");
+   }
+}
+
+TEST_CASE("maybe_tuple - moves are noexcept when every field is", "[maybe_tuple]")
+{
+   struct throwing_move
+   {
+      throwing_move() = default;
+      throwing_move(const throwing_move&) = default;
+      throwing_move(throwing_move&&) noexcept(false) {}
+      ~throwing_move() = default;
+   };
+
+   static_assert(std::is_nothrow_move_constructible_v<record>);
+   static_assert(std::is_nothrow_move_assignable_v<record>);
+   static_assert(not std::is_nothrow_move_constructible_v<maybe_tuple<int, throwing_move>>);
+   static_assert(not std::is_nothrow_move_assignable_v<maybe_tuple<throwing_move, int>>);
+}
+
+#if defined(__cpp_exceptions)
+namespace
+{
+   /**
+    * @brief A payload whose copy fails once `copies_left` reaches zero, counting the live
+    * instances.
+    */
+   struct fragile_copy
+   {
+      static inline int live = 0;
+      static inline int copies_left = -1;
+
+      fragile_copy() { ++live; }
+      fragile_copy(const fragile_copy&)
+      {
+         if (copies_left == 0)
+         {
+            throw std::runtime_error("fragile_copy");
+         }
+
+         --copies_left;
+         ++live;
+      }
+      ~fragile_copy() { --live; }
+
+      auto operator=(const fragile_copy&) -> fragile_copy& = default;
+   };
+} // namespace
+
+TEST_CASE("maybe_tuple - a throwing copy destroys the fields already built", "[maybe_tuple]")
+{
+   using pair = maybe_tuple<fragile_copy, fragile_copy>;
+
+   {
+      pair original;
+      original.emplace<0>();
+      original.emplace<1>();
+
+      REQUIRE(fragile_copy::live == 2);
+
+      fragile_copy::copies_left = 1;
+
+      CHECK_THROWS_AS(pair(original), std::runtime_error);
+      CHECK(fragile_copy::live == 2);
+
+      fragile_copy::copies_left = -1;
+   }
+
+   CHECK(fragile_copy::live == 0);
+}
+#endif // defined(__cpp_exceptions)
+
+TEST_CASE("maybe_tuple - mask operations", "[maybe_tuple]")
+{
+   record rec;
+   rec.emplace<0>(1U);
+   rec.emplace<3>(std::uint16_t(2));
+
+   CHECK(rec.all_of<0, 3>());
+   CHECK_FALSE(rec.all_of<0, 1>());
+   CHECK(rec.any_of<1, 3>());
+   CHECK_FALSE(rec.any_of<1, 2>());
+   CHECK(rec.contains(record::mask_of<0>));
+
+   rec.reset();
+
+   CHECK(rec.mask() == 0);
+}
@@ -0,0 +1,82 @@
+#include "../move_counter.hpp"
+
+#include <libreglisse/optional_view.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <optional>
+#include <string>
+
+using namespace reglisse;
+using test::copy_counter;
+
+TEST_CASE("maybe - std::optional conversions", "[maybe]")
+{
+   SECTION("from std::optional")
+   {
+      std::optional<copy_counter> full{std::in_place};
+
+      copy_counter::reset();
+      const maybe<copy_counter> moved = std::move(full);
+
+      CHECK(moved.is_some());
+      CHECK(copy_counter::moves == 1);
+      CHECK(copy_counter::copies == 0);
+
+      const maybe<std::string> copied = std::optional<std::string>("hello");
+      const maybe<int> empty = std::optional<int>();
+
+      CHECK(copied.borrow() == "hello");
+      CHECK(empty.is_none());
+   }
+   SECTION("to std::optional")
+   {
+      maybe<copy_counter> full = make_maybe<copy_counter>();
+
+      copy_counter::reset();
+      const std::optional<copy_counter> moved = std::move(full).to_optional();
+
+      CHECK(moved.has_value());
+      CHECK(copy_counter::moves == 1);
+      CHECK(copy_counter::copies == 0);
+
+      const maybe<int> value = some(1);
+
+      CHECK(value.to_optional() == std::optional<int>(1));
+      CHECK(maybe<int>().to_optional() == std::nullopt);
+   }
+}
+
+TEST_CASE("optional_view", "[maybe]")
+{
+   SECTION("views the optional in place")
+   {
+      std::optional<std::string> name = "reglisse";
+      const optional_view view = name;
+
+      CHECK(view.is_some());
+      CHECK(&view.borrow() == &*name);
+      CHECK(view.transform(&std::string::size).take_or(0U) == 8);
+
+      view.emplace("maybe");
+      CHECK(*name == "maybe");
+
+      view.reset();
+      CHECK(not name.has_value());
+      CHECK(view.is_none());
+      CHECK(view.take_or("none") == "none");
+   }
+   SECTION("const optional")
+   {
+      const std::optional<int> value = 4;
+      const std::optional<int> empty;
+
+      static_assert(std::same_as<decltype(optional_view(value).borrow()), const int&>);
+
+      CHECK(optional_view(value)
+               .and_then([](int i) { return maybe<int>(some(i * 2)); })
+               .take_or(0) == 8);
+      CHECK(optional_view(empty).match([](int i) { return i; }, [] { return -1; }) == -1);
+      CHECK(optional_view(value).to_maybe() == 4);
+   }
+}
@@ -0,0 +1,110 @@
+#include "../move_counter.hpp"
+
+#include <libreglisse/zip.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+using test::move_counter;
+
+namespace
+{
+   /**
+    * @brief Counts the checked accesses, without stopping invalid ones.
+    */
+   struct counting_check
+   {
+      static inline int calls = 0;
+
+      static void check(bool /*valid*/, const char* /*message*/) { ++calls; }
+   };
+} // namespace
+
+TEST_CASE("maybe - zip", "[maybe][zip]")
+{
+   SECTION("all maybes hold a value")
+   {
+      maybe zipped = zip(maybe(some(1)), maybe(some(std::string("hello"))),
+                         maybe(some(std::vector({1, 1}))));
+
+      REQUIRE(zipped.is_some());
+      CHECK(std::get<0>(zipped.borrow()) == 1);
+      CHECK(std::get<1>(zipped.borrow()) == "hello");
+      CHECK(std::get<2>(zipped.borrow()) == std::vector({1, 1}));
+   }
+   SECTION("one maybe is empty")
+   {
+      maybe zipped = zip(maybe(some(1)), maybe<std::string>(none), maybe(some(1.0f)));
+
+      CHECK(zipped.is_none());
+   }
+   SECTION("single maybe")
+   {
+      maybe zipped = zip(maybe(some(1)));
+
+      REQUIRE(zipped.is_some());
+      CHECK(zipped.borrow() == std::tuple(1));
+   }
+}
+
+TEST_CASE("maybe - lift", "[maybe][zip]")
+{
+   const auto concat = [](int count, const std::string& str) {
+      std::string res;
+      for (int i = 0; i < count; ++i)
+      {
+         res += str;
+      }
+
+      return res;
+   };
+
+   SECTION("all maybes hold a value")
+   {
+      maybe lifted = lift(concat, maybe(some(2)), maybe(some(std::string("ab"))));
+
+      REQUIRE(lifted.is_some());
+      CHECK(lifted.borrow() == "abab");
+   }
+   SECTION("one maybe is empty")
+   {
+      maybe lifted = lift(concat, maybe<int>(none), maybe(some(std::string("ab"))));
+
+      CHECK(lifted.is_none());
+   }
+}
+
+TEST_CASE("maybe - zip and lift test once and move once", "[maybe][zip]")
+{
+   using counted = maybe<move_counter, counting_check>;
+
+   SECTION("zip")
+   {
+      counting_check::calls = 0;
+      auto zipped = zip(counted(std::in_place, 1, 2), counted(std::in_place, 3, 4));
+
+      CHECK(counting_check::calls == 0);
+      REQUIRE(zipped.is_some());
+      CHECK(std::get<0>(zipped.borrow()).moves == 1);
+      CHECK(std::get<1>(zipped.borrow()).moves == 1);
+      CHECK(std::get<1>(zipped.borrow()).second == 4);
+   }
+   SECTION("lift")
+   {
+      const auto merge = [](move_counter&& lhs, move_counter&& rhs) {
+         return move_counter(lhs.first + rhs.first, lhs.moves + rhs.moves);
+      };
+
+      counting_check::calls = 0;
+      auto lifted = lift(merge, counted(std::in_place, 1, 2), counted(std::in_place, 3, 4));
+
+      CHECK(counting_check::calls == 0);
+      REQUIRE(lifted.is_some());
+      CHECK(lifted.borrow().first == 4);
+      CHECK(lifted.borrow().second == 0);
+      CHECK(lifted.borrow().moves == 0);
+   }
+}
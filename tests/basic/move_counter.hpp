@@ -0,0 +1,59 @@
+#ifndef LIBREGLISSE_TESTS_MOVE_COUNTER_HPP
+#define LIBREGLISSE_TESTS_MOVE_COUNTER_HPP
+
+namespace test
+{
+   /**
+    * @brief A move-only payload carrying the number of moves it went through.
+    */
+   struct move_counter
+   {
+      move_counter(int first, int second) noexcept : first(first), second(second) {}
+      move_counter(move_counter&& other) noexcept :
+         first(other.first), second(other.second), moves(other.moves + 1)
+      {}
+      ~move_counter() = default;
+
+      auto operator=(move_counter&& rhs) noexcept -> move_counter&
+      {
+         first = rhs.first;
+         second = rhs.second;
+         moves = rhs.moves + 1;
+
+         return *this;
+      }
+
+      move_counter(const move_counter&) = delete;
+      auto operator=(const move_counter&) -> move_counter& = delete;
+
+      int first;
+      int second;
+      int moves = 0;
+   };
+
+   /**
+    * @brief A copyable payload counting every copy and move construction of the type, call
+    * `reset()` before the operation being measured.
+    */
+   struct copy_counter
+   {
+      static inline int moves = 0;
+      static inline int copies = 0;
+
+      copy_counter() = default;
+      copy_counter(const copy_counter&) { ++copies; }
+      copy_counter(copy_counter&&) noexcept { ++moves; }
+      ~copy_counter() = default;
+
+      auto operator=(const copy_counter&) -> copy_counter& = default;
+      auto operator=(copy_counter&&) noexcept -> copy_counter& = default;
+
+      static void reset()
+      {
+         moves = 0;
+         copies = 0;
+      }
+   };
+} // namespace test
+
+#endif // LIBREGLISSE_TESTS_MOVE_COUNTER_HPP
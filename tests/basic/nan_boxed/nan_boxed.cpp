@@ -0,0 +1,167 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#include <libreglisse/nan_boxed.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using namespace reglisse;
+
+namespace
+{
+   enum struct status : std::uint8_t
+   {
+      overflow = 1,
+      underflow = 2,
+      domain = 255
+   };
+
+   auto bits_of(double value) -> std::uint64_t { return std::bit_cast<std::uint64_t>(value); }
+
+   auto round_trips(double value) -> bool
+   {
+      const nan_boxed_either<double, std::int32_t> boxed = left(double(value));
+
+      return boxed.is_left() and bits_of(boxed.take_left()) == bits_of(value);
+   }
+} // namespace
+
+TEST_CASE("nan_boxed - layout", "[nan_boxed]")
+{
+   static_assert(sizeof(nan_boxed_either<double, std::int32_t>) == sizeof(double));
+   static_assert(sizeof(nan_boxed_result<double, status>) == sizeof(double));
+   static_assert(sizeof(nan_boxed_either<const char*, double>) == sizeof(double));
+   static_assert(std::is_trivially_copyable_v<nan_boxed_either<double, std::int32_t>>);
+   static_assert(sizeof(either<double, std::int32_t>) == 2 * sizeof(double));
+}
+
+TEST_CASE("nan_boxed - double conformance", "[nan_boxed]")
+{
+   SECTION("special values round-trip exactly")
+   {
+      using limits = std::numeric_limits<double>;
+
+      for (const double value :
+           {0.0, -0.0, 1.0, -1.0, limits::min(), -limits::min(), limits::max(), limits::lowest(),
+            limits::epsilon(), limits::denorm_min(), -limits::denorm_min(), limits::infinity(),
+            -limits::infinity()})
+      {
+         CHECK(round_trips(value));
+      }
+   }
+   SECTION("a sweep over the whole bit space round-trips exactly")
+   {
+      constexpr std::uint64_t samples = 1U << 20U;
+      constexpr std::uint64_t stride = std::numeric_limits<std::uint64_t>::max() / samples;
+
+      std::uint64_t failures = 0;
+      for (std::uint64_t i = 0; i < samples; ++i)
+      {
+         const auto value = std::bit_cast<double>(i * stride + i);
+
+         if (not std::isnan(value) and not round_trips(value))
+         {
+            ++failures;
+         }
+      }
+
+      CHECK(failures == 0);
+   }
+   SECTION("canonical NaN round-trips exactly")
+   {
+      CHECK(round_trips(std::numeric_limits<double>::quiet_NaN()));
+      CHECK(round_trips(-std::numeric_limits<double>::quiet_NaN()));
+   }
+   SECTION("NaNs colliding with boxed values stay doubles")
+   {
+      const nan_boxed_either<double, std::int32_t> boxed =
+         left(std::bit_cast<double>(std::uint64_t(0xFFF9'0000'0000'002A)));
+
+      REQUIRE(boxed.is_left());
+      CHECK(std::isnan(boxed.take_left()));
+   }
+}
+
+TEST_CASE("nan_boxed - small values", "[nan_boxed]")
+{
+   SECTION("integers")
+   {
+      for (const std::int32_t value : {0, 1, -1, std::numeric_limits<std::int32_t>::min(),
+                                       std::numeric_limits<std::int32_t>::max()})
+      {
+         const nan_boxed_either<double, std::int32_t> boxed = right(std::int32_t(value));
+
+         REQUIRE(boxed.is_right());
+         CHECK(boxed.take_right() == value);
+      }
+   }
+   SECTION("pointers")
+   {
+      const char* text = "boxed";
+
+      const nan_boxed_either<const char*, double> boxed = left(static_cast<const char*>(text));
+
+      REQUIRE(boxed.is_left());
+      CHECK(boxed.take_left() == text);
+   }
+   SECTION("results")
+   {
+      const auto safe_log = [](double value) -> nan_boxed_result<double, status> {
+         if (value <= 0.0)
+         {
+            return err(status::domain);
+         }
+
+         return ok(std::log(value));
+      };
+
+      CHECK(safe_log(1.0).take() == 0.0);
+      CHECK(safe_log(-1.0).take_err() == status::domain);
+      CHECK(safe_log(-1.0).take_or(-1.0) == -1.0);
+      CHECK(safe_log(1.0).to_result().is_ok());
+      CHECK(safe_log(-1.0).match(
+               [](double) {
+                  return 0;
+               },
+               [](status s) {
+                  return static_cast<int>(s);
+               }) == 255);
+   }
+   SECTION("conversions from either")
+   {
+      const either<double, std::int32_t> wide = right(std::int32_t(-7));
+      const nan_boxed_either<double, std::int32_t> packed(wide);
+
+      CHECK(packed.take_right() == -7);
+      CHECK(packed.to_either().borrow_right() == -7);
+   }
+}
+
+#if defined(__cpp_exceptions)
+TEST_CASE("nan_boxed - pointers outside of the payload are checked", "[nan_boxed]")
+{
+   if constexpr (sizeof(void*) == sizeof(std::uint64_t))
+   {
+      const std::uintptr_t address = 0xFFFF'8000'0000'1000;
+      const auto* high = reinterpret_cast<const char*>(address); // NOLINT
+
+      const auto box_high = [&] {
+         return nan_boxed_either<const char*, double, throw_check>(left(std::move(high)));
+      };
+      const auto box_high_error = [&] {
+         return nan_boxed_result<double, const char*, throw_check>(err(std::move(high)));
+      };
+
+      CHECK_THROWS_AS(box_high(), invalid_access_exception);
+      CHECK_THROWS_AS(box_high_error(), invalid_access_exception);
+   }
+
+   const char* text = "boxed";
+
+   CHECK(nan_boxed_either<const char*, double, throw_check>(left(std::move(text))).take_left() ==
+         text);
+}
+#endif // defined(__cpp_exceptions)
@@ -0,0 +1,399 @@
+#include <libreglisse/match.hpp>
+#include <libreglisse/either.hpp>
+#include <libreglisse/one_of.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace reglisse;
+
+TEST_CASE("one_of - layout", "[one_of]")
+{
+   CHECK(sizeof(one_of<std::uint8_t, std::uint8_t, std::uint8_t>) == 2);
+   CHECK(sizeof(one_of<int, float, std::uint16_t, char>) == 2 * sizeof(int));
+   CHECK(sizeof(one_of<int, float, std::uint16_t, char>) <
+         sizeof(either<int, either<float, either<std::uint16_t, char>>>));
+}
+
+SCENARIO("one_of - constructor", "[one_of]")
+{
+   GIVEN("a one_of constructed using at<I>")
+   {
+      const one_of<int, std::string, std::vector<int>> val = at<1>(std::string("hello"));
+
+      THEN("the second alternative should be active")
+      {
+         CHECK(val.index() == 1);
+         CHECK(val.is<1>());
+         CHECK_FALSE(val.is<0>());
+         CHECK(val.borrow<1>() == "hello");
+      }
+   }
+   GIVEN("a one_of holding the same type twice")
+   {
+      const one_of<int, int> first = at<0>(1);
+      const one_of<int, int> second = at<1>(1);
+
+      THEN("the alternatives should still be told apart")
+      {
+         CHECK(first.is<0>());
+         CHECK(second.is<1>());
+         CHECK(first != second);
+      }
+   }
+   GIVEN("a one_of constructed in place")
+   {
+      const one_of<int, std::vector<int>> val(std::in_place_index<1>, 3, 1);
+
+      THEN("the vector should be constructed from the arguments")
+      {
+         REQUIRE(val.is<1>());
+         CHECK(val.borrow<1>() == std::vector({1, 1, 1}));
+      }
+   }
+   GIVEN("copies and moves of a one_of")
+   {
+      one_of<int, std::string> val = at<1>(std::string("hello"));
+      const one_of<int, std::string> cpy = val; // NOLINT
+      const one_of<int, std::string> moved = std::move(val);
+
+      THEN("they should all hold the same value")
+      {
+         CHECK(cpy.borrow<1>() == "hello");
+         CHECK(moved.borrow<1>() == "hello");
+         CHECK(cpy == moved);
+      }
+   }
+}
+
+TEST_CASE("one_of - operator=", "[one_of]")
+{
+   one_of<int, std::string> val = at<0>(1);
+   const one_of<int, std::string> str = at<1>(std::string("hello"));
+
+   val = str;
+
+   REQUIRE(val.is<1>());
+   CHECK(val.borrow<1>() == "hello");
+
+   val = one_of<int, std::string>(at<0>(2));
+
+   REQUIRE(val.is<0>());
+   CHECK(val.borrow<0>() == 2);
+
+   static_assert(std::is_nothrow_move_constructible_v<one_of<int, std::string>>);
+   static_assert(std::is_nothrow_move_assignable_v<one_of<int, std::string>>);
+   CHECK_FALSE(val.valueless_by_exception());
+}
+
+TEST_CASE("one_of - taking", "[one_of]")
+{
+   one_of<int, std::vector<int>> val = at<1>(std::vector({1, 1}));
+
+   CHECK(std::move(val).take<1>() == std::vector({1, 1}));
+}
+
+TEST_CASE("one_of - transform_at", "[one_of]")
+{
+   using msg = one_of<int, std::string, std::vector<int>>;
+
+   const auto to_size = [](std::string&& str) {
+      return std::size(str);
+   };
+
+   SECTION("the transformed alternative is active")
+   {
+      one_of res = msg(at<1>(std::string("hello"))).transform_at<1>(to_size);
+
+      static_assert(std::same_as<decltype(res), one_of<int, std::size_t, std::vector<int>>>);
+
+      REQUIRE(res.is<1>());
+      CHECK(res.borrow<1>() == 5);
+   }
+   SECTION("another alternative is active")
+   {
+      one_of res = msg(at<2>(std::vector({1, 1}))).transform_at<1>(to_size);
+
+      REQUIRE(res.is<2>());
+      CHECK(res.borrow<2>() == std::vector({1, 1}));
+   }
+   SECTION("lvalues are left untouched")
+   {
+      msg value = at<1>(std::string("hello"));
+      const msg other = at<2>(std::vector({1, 1}));
+
+      one_of appended = value.transform_at<1>([](std::string& str) -> std::string {
+         return str + " world";
+      });
+      one_of size = other.transform_at<1>([](const std::string& str) {
+         return std::size(str);
+      });
+
+      static_assert(std::same_as<decltype(size), one_of<int, std::size_t, std::vector<int>>>);
+
+      REQUIRE(appended.is<1>());
+      CHECK(appended.borrow<1>() == "hello world");
+      CHECK(value.borrow<1>() == "hello");
+
+      REQUIRE(size.is<2>());
+      CHECK(size.borrow<2>() == std::vector({1, 1}));
+      CHECK(other.borrow<2>() == std::vector({1, 1}));
+   }
+}
+
+TEST_CASE("one_of - match", "[one_of]")
+{
+   using msg = one_of<int, std::string, std::vector<int>>;
+
+   SECTION("match(fun&&) const&")
+   {
+      const msg val = at<2>(std::vector({1, 1, 1}));
+
+      const auto size = match(val, overloaded{[](int) {
+                                                 return std::size_t{1};
+                                              },
+                                              [](const std::string& str) {
+                                                 return std::size(str);
+                                              },
+                                              [](const std::vector<int>& vec) {
+                                                 return std::size(vec);
+                                              }});
+
+      CHECK(size == 3);
+   }
+   SECTION("match(funs&&...) &")
+   {
+      msg val = at<0>(1);
+
+      val.match(
+         [](int& i) {
+            i += 1;
+         },
+         [](std::string&) {
+         },
+         [](std::vector<int>&) {
+         });
+
+      REQUIRE(val.is<0>());
+      CHECK(val.borrow<0>() == 2);
+   }
+   SECTION("match(funs&&...) &&")
+   {
+      const auto str = msg(at<1>(std::string("hello")))
+                          .match(
+                             [](int) {
+                                return std::string();
+                             },
+                             [](std::string&& str) {
+                                return std::move(str);
+                             },
+                             [](std::vector<int>&&) {
+                                return std::string();
+                             });
+
+      CHECK(str == "hello");
+   }
+   SECTION("more alternatives than a single jump table block")
+   {
+      using big = one_of<char, short, int, long, float, double, long double, bool, signed char,
+                         unsigned char, unsigned short, unsigned int, unsigned long, long long,
+                         unsigned long long, char16_t, char32_t, std::string>;
+
+      const big val = at<17>(std::string("last"));
+
+      CHECK(match(val, [](const auto& v) {
+         return sizeof(v);
+      }) == sizeof(std::string));
+   }
+}
+
+TEST_CASE("one_of - emplace", "[one_of]")
+{
+   one_of<int, std::string, std::vector<int>> val = at<0>(1);
+
+   std::string& str = val.emplace<1>(3, 'a');
+
+   REQUIRE(val.is<1>());
+   CHECK(&str == &val.borrow<1>());
+   CHECK(str == "aaa");
+
+   val.emplace<2>(2, 4);
+
+   REQUIRE(val.is<2>());
+   CHECK(val.borrow<2>() == std::vector({4, 4}));
+}
+
+TEST_CASE("one_of - immovable alternatives", "[one_of]")
+{
+   static_assert(not std::is_copy_constructible_v<one_of<int, std::mutex>>);
+   static_assert(not std::is_move_constructible_v<one_of<int, std::mutex>>);
+
+   one_of<int, std::mutex> val(std::in_place_index<0>, 1);
+
+   val.emplace<1>();
+
+   REQUIRE(val.is<1>());
+   CHECK(val.borrow<1>().try_lock());
+   val.borrow<1>().unlock();
+}
+
+#if defined(__cpp_exceptions)
+namespace
+{
+   /**
+    * @brief An alternative whose construction and copies fail on request and whose moves fail
+    * once `moves_left` runs out, counting the live instances.
+    */
+   struct fragile
+   {
+      static inline int live = 0;
+      static inline int moves_left = -1;
+
+      explicit fragile(bool fail)
+      {
+         if (fail)
+         {
+            throw std::runtime_error("construction");
+         }
+
+         ++live;
+      }
+      fragile(const fragile& other) : fail_copy(other.fail_copy)
+      {
+         if (fail_copy)
+         {
+            throw std::runtime_error("copy");
+         }
+
+         ++live;
+      }
+      fragile(fragile&& other) : fail_copy(other.fail_copy)
+      {
+         if (moves_left == 0)
+         {
+            throw std::runtime_error("move");
+         }
+
+         --moves_left;
+         ++live;
+      }
+      ~fragile() { --live; }
+
+      auto operator=(const fragile&) -> fragile& = default;
+      auto operator=(fragile&&) -> fragile& = default;
+
+      auto operator==(const fragile&) const -> bool = default;
+
+      bool fail_copy = false;
+   };
+} // namespace
+
+TEST_CASE("one_of - assignments keep the alternative when construction throws", "[one_of]")
+{
+   using one_of_type = one_of<int, fragile>;
+
+   static_assert(not std::is_nothrow_move_constructible_v<one_of_type>);
+   static_assert(not std::is_nothrow_move_assignable_v<one_of_type>);
+
+   SECTION("a throwing copy")
+   {
+      {
+         one_of_type source(std::in_place_index<1>, false);
+         one_of_type target = at<0>(1);
+
+         source.borrow<1>().fail_copy = true;
+
+         CHECK_THROWS_AS(target = source, std::runtime_error);
+         REQUIRE(target.is<0>());
+         CHECK(target.borrow<0>() == 1);
+
+         one_of_type held(std::in_place_index<1>, false);
+
+         CHECK_THROWS_AS(held = source, std::runtime_error);
+         CHECK(held.is<1>());
+         CHECK(fragile::live == 2);
+      }
+
+      CHECK(fragile::live == 0);
+   }
+   SECTION("a throwing move into the temporary")
+   {
+      {
+         one_of_type source(std::in_place_index<1>, false);
+         one_of_type target = at<0>(1);
+
+         fragile::moves_left = 0;
+
+         CHECK_THROWS_AS(target = std::move(source), std::runtime_error);
+         CHECK(target.is<0>());
+         CHECK(fragile::live == 1);
+
+         fragile::moves_left = -1;
+      }
+
+      CHECK(fragile::live == 0);
+   }
+   SECTION("a throwing move into the storage")
+   {
+      {
+         one_of_type source(std::in_place_index<1>, false);
+         one_of_type target = at<0>(1);
+
+         fragile::moves_left = 1;
+
+         CHECK_THROWS_AS(target = std::move(source), std::runtime_error);
+         CHECK(target.valueless_by_exception());
+         CHECK(target.index() == 2);
+         CHECK_FALSE(target.is<0>());
+         CHECK(fragile::live == 1);
+
+         fragile::moves_left = -1;
+
+         const one_of_type copy = target;
+
+         CHECK(copy.valueless_by_exception());
+         CHECK(copy == target);
+
+         target = one_of_type(at<0>(2));
+
+         REQUIRE(target.is<0>());
+         CHECK(target.borrow<0>() == 2);
+      }
+
+      CHECK(fragile::live == 0);
+   }
+}
+
+TEST_CASE("one_of - emplace keeps the alternative when construction throws", "[one_of]")
+{
+   {
+      one_of<int, fragile, std::string> val = at<2>(std::string("held"));
+
+      CHECK_THROWS_AS(val.emplace<1>(true), std::runtime_error);
+      REQUIRE(val.is<2>());
+      CHECK(val.borrow<2>() == "held");
+
+      val.emplace<1>(false);
+
+      CHECK_THROWS_AS(val.emplace<1>(true), std::runtime_error);
+      CHECK(val.is<1>());
+      CHECK(fragile::live == 1);
+   }
+
+   CHECK(fragile::live == 0);
+
+   {
+      one_of<fragile, std::mutex> val(std::in_place_index<0>, false);
+
+      val.emplace<1>();
+
+      REQUIRE(val.is<1>());
+      CHECK(fragile::live == 0);
+   }
+}
+#endif // defined(__cpp_exceptions)
@@ -0,0 +1,117 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/one_of.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   struct pinned
+   {
+      pinned() : self(this) {}
+      pinned(pinned&&) noexcept : self(this) {}
+      ~pinned() = default;
+
+      auto operator=(pinned&&) noexcept -> pinned& { return *this; }
+
+      pinned(const pinned&) = delete;
+      auto operator=(const pinned&) -> pinned& = delete;
+
+      pinned* self;
+   };
+} // namespace
+
+TEST_CASE("relocate - is_trivially_relocatable", "[relocate]")
+{
+   static_assert(is_trivially_relocatable_v<int>);
+   static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>);
+   static_assert(not is_trivially_relocatable_v<pinned>);
+
+   static_assert(is_trivially_relocatable_v<maybe<int>>);
+   static_assert(is_trivially_relocatable_v<maybe<std::unique_ptr<int>>>);
+   static_assert(not is_trivially_relocatable_v<maybe<pinned>>);
+
+   static_assert(is_trivially_relocatable_v<result<std::unique_ptr<int>, int>>);
+   static_assert(not is_trivially_relocatable_v<result<int, pinned>>);
+
+   static_assert(is_trivially_relocatable_v<either<int, std::unique_ptr<float>>>);
+   static_assert(not is_trivially_relocatable_v<either<pinned, int>>);
+
+   static_assert(is_trivially_relocatable_v<one_of<int, float, std::unique_ptr<int>>>);
+   static_assert(not is_trivially_relocatable_v<one_of<int, pinned>>);
+
+   static_assert(is_trivially_relocatable_v<maybe<result<std::unique_ptr<int>, int>>>);
+}
+
+TEST_CASE("relocate - relocate", "[relocate]")
+{
+   SECTION("trivially relocatable objects")
+   {
+      constexpr std::size_t count = 4;
+
+      std::allocator<maybe<std::unique_ptr<int>>> alloc;
+
+      auto* source = alloc.allocate(count);
+      auto* dest = alloc.allocate(count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::construct_at(source + i, some(std::make_unique<int>(static_cast<int>(i))));
+      }
+
+      auto* end = relocate(source, source + count, dest);
+
+      CHECK(end == dest + count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         REQUIRE(dest[i].is_some());                      // NOLINT
+         CHECK(*dest[i].borrow() == static_cast<int>(i)); // NOLINT
+      }
+
+      std::destroy(dest, end);
+
+      alloc.deallocate(source, count);
+      alloc.deallocate(dest, count);
+   }
+   SECTION("other objects are moved")
+   {
+      constexpr std::size_t count = 3;
+
+      std::allocator<pinned> alloc;
+
+      auto* source = alloc.allocate(count);
+      auto* dest = alloc.allocate(count);
+
+      std::uninitialized_default_construct(source, source + count);
+
+      auto* end = relocate(source, source + count, dest);
+
+      CHECK(end == dest + count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         CHECK(dest[i].self == dest + i); // NOLINT
+      }
+
+      std::destroy(dest, end);
+
+      alloc.deallocate(source, count);
+      alloc.deallocate(dest, count);
+   }
+   SECTION("empty range")
+   {
+      int value = 0;
+
+      CHECK(relocate(&value, &value, &value) == &value);
+   }
+}
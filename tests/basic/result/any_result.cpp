@@ -0,0 +1,92 @@
+#include "../move_counter.hpp"
+
+#include <libreglisse/any_result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+using namespace reglisse;
+using test::copy_counter;
+
+namespace
+{
+   using large = std::array<std::uint64_t, 8>; // NOLINT
+
+   auto parse(int value) -> any_result
+   {
+      if (value < 0)
+      {
+         return err(std::string("negative"));
+      }
+
+      return ok(int(value));
+   }
+} // namespace
+
+TEST_CASE("any_result", "[result]")
+{
+   static_assert(not std::copy_constructible<any_result>);
+   static_assert(std::move_constructible<any_result>);
+
+   SECTION("erases and restores the value and error types")
+   {
+      any_result value = result<int, std::string>(ok(1));
+      any_result error = result<int, std::string>(err(std::string("failed")));
+
+      CHECK(value.holds<int>());
+      CHECK(not value.holds_err<int>());
+      CHECK(error.holds_err<std::string>());
+      CHECK(error.type() == typeid(std::string));
+
+      CHECK(std::move(value).to_result<int, std::string>().borrow() == 1);
+      CHECK(std::move(error).to_result<int, std::string>().borrow_err() == "failed");
+   }
+   SECTION("payloads are moved once")
+   {
+      result<copy_counter, int> typed = ok(copy_counter());
+
+      copy_counter::reset();
+      any_result erased = std::move(typed);
+      CHECK(copy_counter::moves == 1);
+
+      copy_counter::reset();
+      const auto restored = std::move(erased).to_result<copy_counter, int>();
+      CHECK(restored.is_ok());
+      CHECK(copy_counter::moves == 1);
+   }
+   SECTION("large payloads")
+   {
+      any_result big{in_place_ok, std::in_place_type<large>, large{5, 6}};
+      any_result moved = std::move(big);
+
+      CHECK(moved.borrow<large>()[1] == 6);
+   }
+   SECTION("monadic operations")
+   {
+      CHECK(parse(2).transform<int>([](int i) { return i * 2; }).take_or<int>(0) == 4);
+      CHECK(parse(-2).transform<int>([](int i) { return i * 2; }).take_or<int>(0) == 0);
+      CHECK(parse(-2)
+               .transform_err<std::string>(&std::string::size)
+               .borrow_err<std::size_t>() == 8);
+
+      auto checked = [](int i) -> result<int, std::string> {
+         if (i > 10)
+         {
+            return err(std::string("too large"));
+         }
+
+         return ok(int(i));
+      };
+
+      CHECK(parse(3).and_then<int>(checked).borrow<int>() == 3);
+      CHECK(parse(11).and_then<int>(checked).borrow_err<std::string>() == "too large");
+      CHECK(parse(-1)
+               .or_else<std::string>([](std::string&&) { return parse(0); })
+               .borrow<int>() == 0);
+      CHECK(parse(-1).match<int, std::string>([](int) { return std::size_t{0}; },
+                                              [](std::string&& e) { return e.size(); }) == 8);
+   }
+}
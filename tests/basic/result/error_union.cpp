@@ -0,0 +1,321 @@
+#include <libreglisse/error_union.hpp>
+#include <libreglisse/overloaded.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+using namespace reglisse;
+
+namespace
+{
+   enum struct parse_error
+   {
+      invalid_char
+   };
+
+   struct validation_error
+   {
+      std::string field;
+
+      auto operator==(const validation_error&) const -> bool = default;
+   };
+
+   enum struct io_error
+   {
+      eof,
+      closed
+   };
+
+   auto parse(const std::string& str) -> result<int, parse_error>
+   {
+      if (str.empty() || str[0] < '0' || str[0] > '9')
+      {
+         return err(parse_error::invalid_char);
+      }
+
+      return ok(str[0] - '0');
+   }
+
+   auto validate(int val) -> result<int, validation_error>
+   {
+      if (val > 5)
+      {
+         return err(validation_error{.field = "val"});
+      }
+
+      return ok(std::move(val));
+   }
+
+   auto store(int val) -> result<int, io_error>
+   {
+      if (val == 0)
+      {
+         return err(io_error::closed);
+      }
+
+      return ok(val * 2);
+   }
+} // namespace
+
+TEST_CASE("error_union - construction", "[result][error_union]")
+{
+   const error_union<parse_error, validation_error> error = validation_error{.field = "a"};
+
+   CHECK(sizeof(error_union<parse_error, io_error>) == 2 * sizeof(int));
+   CHECK(error.index() == 1);
+   CHECK(error.holds<validation_error>());
+   CHECK_FALSE(error.holds<parse_error>());
+   CHECK(error.borrow<validation_error>().field == "a");
+
+   const error_union<parse_error, validation_error, io_error> widened = error;
+
+   REQUIRE(widened.holds<validation_error>());
+   CHECK(widened.borrow<validation_error>().field == "a");
+   CHECK(widened == validation_error{.field = "a"});
+}
+
+TEST_CASE("error_union - immovable errors", "[result][error_union]")
+{
+   static_assert(std::is_destructible_v<error_union<int, std::mutex>>);
+   static_assert(not std::is_copy_constructible_v<error_union<int, std::mutex>>);
+   static_assert(not std::is_move_constructible_v<error_union<int, std::mutex>>);
+   static_assert(not std::is_move_assignable_v<error_union<int, std::mutex>>);
+
+   const error_union<int, std::mutex> error = 3;
+
+   CHECK(error.holds<int>());
+   CHECK(error.borrow<int>() == 3);
+}
+
+TEST_CASE("error_union - visit", "[result][error_union]")
+{
+   error_union<parse_error, validation_error, io_error> error = io_error::eof;
+
+   const auto to_string = overloaded{[](parse_error) {
+                                        return std::string("parse");
+                                     },
+                                     [](const validation_error& e) {
+                                        return "validation " + e.field;
+                                     },
+                                     [](io_error) {
+                                        return std::string("io");
+                                     }};
+
+   CHECK(error.visit(to_string) == "io");
+
+   error = validation_error{.field = "name"};
+
+   CHECK(std::as_const(error).visit(to_string) == "validation name");
+   CHECK(std::move(error).visit(to_string) == "validation name");
+}
+
+TEST_CASE("result - and_then error widening", "[result][error_union]")
+{
+   using error_type = error_union<parse_error, validation_error, io_error>;
+
+   SECTION("value propagates through the chain")
+   {
+      result res = parse("3").and_then(validate).and_then(store);
+
+      static_assert(std::same_as<decltype(res), result<int, error_type>>);
+
+      REQUIRE(res.is_ok());
+      CHECK(res.borrow() == 6);
+   }
+   SECTION("the first error of the chain is kept")
+   {
+      result res = parse("x").and_then(validate).and_then(store);
+
+      REQUIRE(res.is_err());
+      CHECK(res.borrow_err() == parse_error::invalid_char);
+   }
+   SECTION("errors from later continuations are kept")
+   {
+      result res = parse("9").and_then(validate).and_then(store);
+
+      REQUIRE(res.is_err());
+      CHECK(res.borrow_err() == validation_error{.field = "val"});
+
+      result closed = parse("0").and_then(validate).and_then(store);
+
+      REQUIRE(closed.is_err());
+      CHECK(closed.borrow_err() == io_error::closed);
+   }
+   SECTION("the same error type is not widened")
+   {
+      result res = parse("1").and_then([](int val) {
+         return parse(std::to_string(val + 1));
+      });
+
+      static_assert(std::same_as<decltype(res), result<int, parse_error>>);
+
+      REQUIRE(res.is_ok());
+      CHECK(res.borrow() == 2);
+   }
+}
+
+TEST_CASE("result - transform_err over an error_union", "[result][error_union]")
+{
+   const auto to_code = overloaded{[](parse_error) {
+                                      return 1;
+                                   },
+                                   [](const validation_error&) {
+                                      return 2;
+                                   },
+                                   [](io_error) {
+                                      return 3;
+                                   }};
+
+   result res = parse("9").and_then(validate).and_then(store).transform_err(to_code);
+
+   static_assert(std::same_as<decltype(res), result<int, int>>);
+
+   REQUIRE(res.is_err());
+   CHECK(res.borrow_err() == 2);
+
+   result whole = parse("0").and_then(store).transform_err(
+      [](error_union<parse_error, io_error> error) {
+         return error.index();
+      });
+
+   REQUIRE(whole.is_err());
+   CHECK(whole.borrow_err() == 1);
+}
+
+TEST_CASE("error_union - move operations", "[result][error_union]")
+{
+   static_assert(std::is_nothrow_move_constructible_v<error_union<parse_error, io_error>>);
+   static_assert(std::is_nothrow_move_assignable_v<error_union<parse_error, io_error>>);
+
+   error_union<parse_error, validation_error, io_error> error = io_error::eof;
+
+   CHECK_FALSE(error.valueless_by_exception());
+
+   error = error_union<parse_error, validation_error, io_error>(validation_error{.field = "a"});
+
+   REQUIRE(error.holds<validation_error>());
+   CHECK(error.borrow<validation_error>().field == "a");
+}
+
+#if defined(__cpp_exceptions)
+namespace
+{
+   /**
+    * @brief An error whose copies fail on request and whose moves fail once `moves_left` runs
+    * out, counting the live instances.
+    */
+   struct fragile_error
+   {
+      static inline int live = 0;
+      static inline int moves_left = -1;
+
+      explicit fragile_error(bool fail_copy) : fail_copy(fail_copy) { ++live; }
+      fragile_error(const fragile_error& other) : fail_copy(other.fail_copy)
+      {
+         if (fail_copy)
+         {
+            throw std::runtime_error("copy");
+         }
+
+         ++live;
+      }
+      fragile_error(fragile_error&& other) : fail_copy(other.fail_copy)
+      {
+         if (moves_left == 0)
+         {
+            throw std::runtime_error("move");
+         }
+
+         --moves_left;
+         ++live;
+      }
+      ~fragile_error() { --live; }
+
+      auto operator=(const fragile_error&) -> fragile_error& = default;
+      auto operator=(fragile_error&&) -> fragile_error& = default;
+
+      auto operator==(const fragile_error&) const -> bool = default;
+
+      bool fail_copy;
+   };
+} // namespace
+
+TEST_CASE("error_union - assignments keep the error when construction throws",
+          "[result][error_union]")
+{
+   using union_type = error_union<io_error, fragile_error>;
+
+   static_assert(not std::is_nothrow_move_constructible_v<union_type>);
+   static_assert(not std::is_nothrow_move_assignable_v<union_type>);
+
+   SECTION("a throwing copy")
+   {
+      {
+         const union_type source = fragile_error(true);
+         union_type target = io_error::closed;
+
+         CHECK_THROWS_AS(target = source, std::runtime_error);
+         REQUIRE(target.holds<io_error>());
+         CHECK(target.borrow<io_error>() == io_error::closed);
+
+         union_type held = fragile_error(false);
+
+         CHECK_THROWS_AS(held = source, std::runtime_error);
+         CHECK(held.holds<fragile_error>());
+         CHECK(fragile_error::live == 2);
+      }
+
+      CHECK(fragile_error::live == 0);
+   }
+   SECTION("a throwing move into the temporary")
+   {
+      {
+         union_type source = fragile_error(false);
+         union_type target = io_error::closed;
+
+         fragile_error::moves_left = 0;
+
+         CHECK_THROWS_AS(target = std::move(source), std::runtime_error);
+         CHECK(target.holds<io_error>());
+         CHECK(fragile_error::live == 1);
+
+         fragile_error::moves_left = -1;
+      }
+
+      CHECK(fragile_error::live == 0);
+   }
+   SECTION("a throwing move into the storage")
+   {
+      {
+         union_type source = fragile_error(false);
+         union_type target = io_error::closed;
+
+         fragile_error::moves_left = 1;
+
+         CHECK_THROWS_AS(target = std::move(source), std::runtime_error);
+         CHECK(target.valueless_by_exception());
+         CHECK(target.index() == 2);
+         CHECK_FALSE(target.holds<io_error>());
+         CHECK(fragile_error::live == 1);
+
+         fragile_error::moves_left = -1;
+
+         const union_type copy = target;
+
+         CHECK(copy.valueless_by_exception());
+         CHECK(copy == target);
+
+         target = io_error::eof;
+
+         CHECK(target.holds<io_error>());
+      }
+
+      CHECK(fragile_error::live == 0);
+   }
+}
+#endif // defined(__cpp_exceptions)
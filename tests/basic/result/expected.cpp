@@ -0,0 +1,34 @@
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace reglisse;
+
+#if defined(LIBREGLISSE_REQUIRE_EXPECTED) && !defined(__cpp_lib_expected)
+#   error "std::expected is not available, its conversions would not be tested"
+#endif // defined(LIBREGLISSE_REQUIRE_EXPECTED) && !defined(__cpp_lib_expected)
+
+#if defined(__cpp_lib_expected)
+TEST_CASE("result - std::expected conversions", "[result]")
+{
+   SECTION("from std::expected")
+   {
+      const result<int, std::string> value = std::expected<int, std::string>(1);
+      const result<int, std::string> error =
+         std::expected<int, std::string>(std::unexpect, "failed");
+
+      CHECK(value.borrow() == 1);
+      CHECK(error.borrow_err() == "failed");
+   }
+   SECTION("to std::expected")
+   {
+      result<std::string, int> value = ok(std::string("value"));
+      const result<std::string, int> error = err(2);
+
+      CHECK(std::move(value).to_expected() == "value");
+      CHECK(error.to_expected().error() == 2);
+   }
+}
+#endif // defined(__cpp_lib_expected)
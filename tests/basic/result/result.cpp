@@ -1,10 +1,19 @@
+#include "../move_counter.hpp"
+
 #include <libreglisse/result.hpp>
+#include <libreglisse/match.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 using namespace reglisse;
+using test::move_counter;
 
 SCENARIO("result - constructor", "[result]")
 {
@@ -144,3 +153,333 @@ SCENARIO("result - borrowing", "[result]") {}
 SCENARIO("result - taking", "[result]") {}
 
 SCENARIO("result - transforming the data", "[result]") {}
+
+TEST_CASE("result - match", "[result]")
+{
+   const auto describe = overloaded{[](const std::vector<int>& vec) {
+                                       return std::to_string(std::size(vec));
+                                    },
+                                    [](const std::string& str) {
+                                       return str;
+                                    }};
+
+   SECTION("match(fun&&) const&")
+   {
+      const result<std::vector<int>, std::string> res_vec = ok(std::vector({1, 1, 1}));
+      const result<std::vector<int>, std::string> res_str = err(std::string("error"));
+
+      CHECK(match(res_vec, describe) == "3");
+      CHECK(match(res_str, describe) == "error");
+   }
+   SECTION("match(ok_fun&&, err_fun&&) &")
+   {
+      result<int, int> res = err(1);
+
+      match(
+         res,
+         [](int& val) {
+            val = 0;
+         },
+         [](int& error) {
+            error += 1;
+         });
+
+      REQUIRE(res.is_err());
+      CHECK(res.borrow_err() == 2);
+   }
+   SECTION("match(ok_fun&&, err_fun&&) &&")
+   {
+      const int val = result<int, int>(ok(1)).match(
+         [](int&& val) {
+            return val + 1;
+         },
+         [](int&& error) {
+            return error;
+         });
+
+      CHECK(val == 2);
+   }
+}
+
+TEST_CASE("result - in place construction", "[result]")
+{
+   SECTION("in_place_ok and in_place_err constructors")
+   {
+      const result<move_counter, std::string> value(in_place_ok, 1, 2);
+      const result<int, move_counter> error(in_place_err, 3, 4);
+
+      REQUIRE(value.is_ok());
+      CHECK(value.borrow().first == 1);
+      CHECK(value.borrow().moves == 0);
+
+      REQUIRE(error.is_err());
+      CHECK(error.borrow_err().second == 4);
+      CHECK(error.borrow_err().moves == 0);
+   }
+   SECTION("make_ok and make_err")
+   {
+      const auto value = make_ok<move_counter, int>(1, 2);
+      const auto error = make_err<int, std::string>(3, 'a');
+
+      REQUIRE(value.is_ok());
+      CHECK(value.borrow().moves == 0);
+
+      REQUIRE(error.is_err());
+      CHECK(error.borrow_err() == "aaa");
+   }
+   SECTION("emplace and emplace_err")
+   {
+      result<move_counter, std::string> res = err(std::string("error"));
+
+      move_counter& inner = res.emplace(5, 6);
+
+      REQUIRE(res.is_ok());
+      CHECK(&inner == &res.borrow());
+      CHECK(inner.moves == 0);
+
+      res.emplace_err(2, 'b');
+
+      REQUIRE(res.is_err());
+      CHECK(res.borrow_err() == "bb");
+   }
+}
+
+TEST_CASE("result - non consuming operations", "[result]")
+{
+   struct config
+   {
+      std::string name;
+      std::vector<int> ports;
+   };
+
+   const result<config, std::string> cached = ok(config{.name = "server", .ports = {80, 443}});
+   const result<config, std::string> failed = err(std::string("missing"));
+
+   SECTION("transform(fun&&) const&")
+   {
+      const result<std::string, std::string> name = cached.transform(&config::name);
+
+      REQUIRE(name.is_ok());
+      CHECK(name.borrow() == "server");
+      CHECK(cached.borrow().name == "server");
+
+      CHECK(failed.transform(&config::name).borrow_err() == "missing");
+   }
+   SECTION("transform(fun&&) &")
+   {
+      result<config, std::string> val = ok(config{.name = "server", .ports = {80}});
+
+      const auto count = val.transform([](config& c) {
+         c.ports.push_back(443);
+         return c.ports.size();
+      });
+
+      CHECK(count.borrow() == 2);
+      CHECK(val.borrow().ports.size() == 2);
+   }
+   SECTION("transform_err(fun&&) const&")
+   {
+      const auto length = failed.transform_err([](const std::string& error) {
+         return error.size();
+      });
+
+      CHECK(length.borrow_err() == 7);
+      CHECK(failed.borrow_err() == "missing");
+   }
+   SECTION("and_then(fun&&) const&")
+   {
+      const auto first_port = cached.and_then([](const config& c) -> result<int, std::string> {
+         if (c.ports.empty())
+         {
+            return err(std::string("no ports"));
+         }
+
+         return ok(int(c.ports.front()));
+      });
+
+      CHECK(first_port.borrow() == 80);
+   }
+   SECTION("or_else(fun&&) const&")
+   {
+      const auto recovered = failed.or_else([](const std::string& error) {
+         return result<config, std::string>(ok(config{.name = error, .ports = {}}));
+      });
+
+      CHECK(recovered.borrow().name == "missing");
+      CHECK(failed.borrow_err() == "missing");
+   }
+}
+
+TEST_CASE("result - take_err_or on a const rvalue", "[result]")
+{
+   const result<int, long> success = ok(1);
+   const result<int, long> failure = err(7L);
+
+   CHECK(std::move(success).take_err_or(-1L) == -1L); // NOLINT
+   CHECK(std::move(failure).take_err_or(-1L) == 7L);  // NOLINT
+
+   const result<std::string, std::string> named = ok(std::string("value"));
+   const result<std::string, std::string> failed = err(std::string("error"));
+
+   CHECK(std::move(named).take_err_or("fallback") == "fallback"); // NOLINT
+   CHECK(std::move(failed).take_err_or("fallback") == "error");   // NOLINT
+}
+
+TEST_CASE("result - transform constructs the new value in place", "[result]")
+{
+   const auto next = [](const move_counter& c) {
+      return move_counter(c.first + 1, c.second);
+   };
+
+   SECTION("transform(fun&&) &&")
+   {
+      const auto val = result<move_counter, std::string>(in_place_ok, 1, 2)
+                          .transform(next)
+                          .transform(next)
+                          .transform(next);
+
+      REQUIRE(val.is_ok());
+      CHECK(val.borrow().first == 4);
+      CHECK(val.borrow().moves == 0);
+   }
+   SECTION("transform(fun&&) && forwards the error with a single move")
+   {
+      const auto val = result<int, move_counter>(in_place_err, 1, 2).transform([](int i) {
+         return i + 1;
+      });
+
+      REQUIRE(val.is_err());
+      CHECK(val.borrow_err().moves == 1);
+   }
+   SECTION("transform_err(fun&&) &&")
+   {
+      const auto val = result<int, move_counter>(in_place_err, 1, 2)
+                          .transform_err(next)
+                          .transform_err(next);
+
+      REQUIRE(val.is_err());
+      CHECK(val.borrow_err().first == 3);
+      CHECK(val.borrow_err().moves == 0);
+   }
+   SECTION("transform(fun&&) const&")
+   {
+      const result<move_counter, std::string> cached(in_place_ok, 1, 2);
+
+      const auto val = cached.transform(next);
+
+      REQUIRE(val.is_ok());
+      CHECK(val.borrow().moves == 0);
+   }
+}
+
+TEST_CASE("result - immovable values", "[result]")
+{
+   static_assert(not std::is_copy_constructible_v<result<std::mutex, int>>);
+   static_assert(not std::is_move_constructible_v<result<int, std::mutex>>);
+
+   result<std::atomic<int>, std::string> counter(in_place_ok, 1);
+
+   REQUIRE(counter.is_ok());
+   CHECK(counter.borrow().fetch_add(1) == 1);
+
+   counter.emplace_err(std::string("poisoned"));
+
+   REQUIRE(counter.is_err());
+   CHECK(counter.borrow_err() == "poisoned");
+
+   counter.emplace(5);
+
+   REQUIRE(counter.is_ok());
+   CHECK(counter.borrow().load() == 5);
+}
+
+namespace
+{
+   /**
+    * @brief A copy-only payload, whose copy may throw and which has no move constructor.
+    */
+   struct legacy
+   {
+      static inline bool fail = false;
+
+      legacy(int value) : value(value) {} // NOLINT
+      legacy(const legacy& other) : value(other.value)
+      {
+         if (fail)
+         {
+#if defined(__cpp_exceptions)
+            throw std::runtime_error("legacy");
+#endif // defined(__cpp_exceptions)
+         }
+      }
+      ~legacy() = default;
+
+      auto operator=(const legacy& other) -> legacy& = default;
+
+      int value;
+   };
+} // namespace
+
+TEST_CASE("result - copy only values", "[result]")
+{
+   static_assert(not std::is_nothrow_move_constructible_v<legacy>);
+
+   legacy::fail = false;
+
+   const result<legacy, int> value = ok(legacy(1));
+   result<legacy, int> target = err(2);
+
+   target = value;
+
+   REQUIRE(target.is_ok());
+   CHECK(target.borrow().value == 1);
+
+   target.emplace(3);
+   target.emplace_err(4);
+   target.emplace(legacy(5));
+
+   REQUIRE(target.is_ok());
+   CHECK(target.borrow().value == 5);
+
+#if defined(__cpp_exceptions)
+   target.emplace_err(6);
+   legacy::fail = true;
+
+   CHECK_THROWS_AS(target = value, std::runtime_error);
+   REQUIRE(target.is_err());
+   CHECK(target.borrow_err() == 6);
+
+   legacy::fail = false;
+#endif // defined(__cpp_exceptions)
+}
+
+TEST_CASE("result - same value and error type", "[result]")
+{
+   static_assert(sizeof(result<std::uint64_t, std::uint64_t>) == 2 * sizeof(std::uint64_t));
+   static_assert(std::is_trivially_copyable_v<result<int, int>>);
+
+   SECTION("copies keep the state")
+   {
+      const result<std::string, std::string> res = err(std::string("missing"));
+      const auto copy = res; // NOLINT
+
+      REQUIRE(copy.is_err());
+      CHECK(copy.borrow_err() == "missing");
+   }
+   SECTION("join")
+   {
+      result<move_counter, move_counter> res(in_place_err, 1, 2);
+
+      const move_counter joined = std::move(res).join();
+
+      CHECK(joined.first == 1);
+      CHECK(joined.moves == 1);
+   }
+   SECTION("widening the error into the value type")
+   {
+      const result<long, long> widened = result<long, int>(err(3));
+
+      REQUIRE(widened.is_err());
+      CHECK(widened.borrow_err() == 3);
+   }
+}
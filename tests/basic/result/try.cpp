@@ -0,0 +1,49 @@
+#include <libreglisse/try.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   auto parse_positive(int value) -> int
+   {
+#if defined(__cpp_exceptions)
+      if (value < 0)
+      {
+         throw std::invalid_argument("negative");
+      }
+#endif // defined(__cpp_exceptions)
+
+      return value;
+   }
+} // namespace
+
+TEST_CASE("try_wrap", "[result]")
+{
+   SECTION("the return value is held as a value")
+   {
+      const auto res = try_wrap<std::invalid_argument>(parse_positive, 3);
+
+      static_assert(std::same_as<decltype(res), const result<int, std::invalid_argument>>);
+
+      CHECK(res.is_ok());
+      CHECK(res.borrow() == 3);
+   }
+#if defined(__cpp_exceptions)
+   SECTION("the exception is held as an error")
+   {
+      const auto res = try_wrap<std::invalid_argument>(parse_positive, -3);
+
+      CHECK(res.is_err());
+      CHECK(std::string(res.borrow_err().what()) == "negative");
+   }
+   SECTION("other exceptions are not caught")
+   {
+      CHECK_THROWS_AS(try_wrap<std::out_of_range>(parse_positive, -3), std::invalid_argument);
+   }
+#endif // defined(__cpp_exceptions)
+}
@@ -0,0 +1,167 @@
+#include "../move_counter.hpp"
+
+#include <libreglisse/zip.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+using test::move_counter;
+
+namespace
+{
+   enum struct parse_error
+   {
+      invalid_char
+   };
+
+   enum struct io_error
+   {
+      eof
+   };
+
+   struct to_string_error
+   {
+      auto operator()(parse_error) const -> std::string { return "parse error"; }
+      auto operator()(io_error) const -> std::string { return "io error"; }
+   };
+
+   /**
+    * @brief Counts the checked accesses, without stopping invalid ones.
+    */
+   struct counting_check
+   {
+      static inline int calls = 0;
+
+      static void check(bool /*valid*/, const char* /*message*/) { ++calls; }
+   };
+} // namespace
+
+TEST_CASE("result - zip", "[result][zip]")
+{
+   SECTION("all results hold a value")
+   {
+      result zipped = zip(result<int, int>(ok(1)), result<std::string, int>(ok(std::string("a"))));
+
+      REQUIRE(zipped.is_ok());
+      CHECK(std::get<0>(zipped.borrow()) == 1);
+      CHECK(std::get<1>(zipped.borrow()) == "a");
+   }
+   SECTION("the first error is kept")
+   {
+      result zipped = zip(result<int, int>(ok(1)), result<float, int>(err(2)),
+                          result<std::string, int>(err(3)));
+
+      REQUIRE(zipped.is_err());
+      CHECK(zipped.borrow_err() == 2);
+   }
+   SECTION("heterogeneous errors are mapped using the policy")
+   {
+      result zipped = zip(to_string_error(), result<int, parse_error>(ok(1)),
+                          result<float, io_error>(err(io_error::eof)));
+
+      REQUIRE(zipped.is_err());
+      CHECK(zipped.borrow_err() == "io error");
+   }
+}
+
+TEST_CASE("result - lift", "[result][zip]")
+{
+   const auto add = [](int lhs, float rhs) {
+      return static_cast<float>(lhs) + rhs;
+   };
+
+   SECTION("all results hold a value")
+   {
+      result lifted = lift(add, result<int, int>(ok(1)), result<float, int>(ok(1.0f)));
+
+      REQUIRE(lifted.is_ok());
+      CHECK(lifted.borrow() == 2.0f);
+   }
+   SECTION("one result holds an error")
+   {
+      result lifted = lift(add, result<int, int>(ok(1)), result<float, int>(err(1)));
+
+      REQUIRE(lifted.is_err());
+      CHECK(lifted.borrow_err() == 1);
+   }
+   SECTION("heterogeneous errors are mapped using the policy")
+   {
+      result lifted = lift(to_string_error(), add,
+                           result<int, parse_error>(err(parse_error::invalid_char)),
+                           result<float, io_error>(ok(1.0f)));
+
+      REQUIRE(lifted.is_err());
+      CHECK(lifted.borrow_err() == "parse error");
+   }
+}
+
+TEST_CASE("result - zip and lift take a stateful error policy", "[result][zip]")
+{
+   const std::string prefix = "failed: ";
+   const auto describe = [&prefix](int code) {
+      return prefix + std::to_string(code);
+   };
+
+   SECTION("zip")
+   {
+      result zipped = zip(describe, result<int, int>(ok(1)), result<float, int>(err(2)));
+
+      REQUIRE(zipped.is_err());
+      CHECK(zipped.borrow_err() == "failed: 2");
+   }
+   SECTION("lift")
+   {
+      const auto add = [](int lhs, float rhs) {
+         return static_cast<float>(lhs) + rhs;
+      };
+
+      result lifted = lift(describe, add, result<int, int>(err(3)), result<float, int>(ok(1.0f)));
+
+      REQUIRE(lifted.is_err());
+      CHECK(lifted.borrow_err() == "failed: 3");
+   }
+}
+
+TEST_CASE("result - zip and lift test once and move once", "[result][zip]")
+{
+   using counted = result<move_counter, int, counting_check>;
+
+   SECTION("zip")
+   {
+      counting_check::calls = 0;
+      auto zipped = zip(counted(in_place_ok, 1, 2), counted(in_place_ok, 3, 4));
+
+      CHECK(counting_check::calls == 0);
+      REQUIRE(zipped.is_ok());
+      CHECK(std::get<0>(zipped.borrow()).moves == 1);
+      CHECK(std::get<1>(zipped.borrow()).moves == 1);
+      CHECK(std::get<1>(zipped.borrow()).second == 4);
+   }
+   SECTION("lift")
+   {
+      const auto merge = [](move_counter&& lhs, move_counter&& rhs) {
+         return move_counter(lhs.first + rhs.first, lhs.moves + rhs.moves);
+      };
+
+      counting_check::calls = 0;
+      auto lifted = lift(merge, counted(in_place_ok, 1, 2), counted(in_place_ok, 3, 4));
+
+      CHECK(counting_check::calls == 0);
+      REQUIRE(lifted.is_ok());
+      CHECK(lifted.borrow().first == 4);
+      CHECK(lifted.borrow().second == 0);
+      CHECK(lifted.borrow().moves == 0);
+   }
+   SECTION("the first error")
+   {
+      counting_check::calls = 0;
+      auto zipped = zip(counted(in_place_ok, 1, 2), counted(err(3)));
+
+      CHECK(counting_check::calls == 0);
+      REQUIRE(zipped.is_err());
+      CHECK(zipped.borrow_err() == 3);
+   }
+}
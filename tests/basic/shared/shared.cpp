@@ -0,0 +1,385 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#include <libreglisse/error_union.hpp>
+#include <libreglisse/overloaded.hpp>
+#include <libreglisse/shared.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   struct config_snapshot
+   {
+      std::string name;
+      std::vector<int> ports;
+   };
+} // namespace
+
+TEST_CASE("shared - reference counting", "[shared]")
+{
+   static_assert(sizeof(shared<config_snapshot>) == sizeof(void*));
+   static_assert(is_trivially_relocatable_v<shared_result<config_snapshot, int>>);
+   static_assert(is_trivially_relocatable_v<shared_maybe<config_snapshot>>);
+   static_assert(sizeof(shared_result<config_snapshot, int>) == 2 * sizeof(void*));
+   static_assert(sizeof(shared_maybe<config_snapshot>) == sizeof(void*));
+
+   SECTION("copies share the value")
+   {
+      const auto snapshot =
+         make_shared_value<config_snapshot>(config_snapshot{.name = "main", .ports = {80}});
+      const auto copy = snapshot; // NOLINT
+
+      CHECK(snapshot.use_count() == 2);
+      CHECK(&copy.get() == &snapshot.get());
+      CHECK(copy->name == "main");
+   }
+   SECTION("local reference count")
+   {
+      const auto value = make_shared_value<std::string, local_refcount>("local");
+
+      {
+         const auto copy = value; // NOLINT
+
+         CHECK(value.use_count() == 2);
+      }
+
+      CHECK(value.use_count() == 1);
+   }
+}
+
+TEST_CASE("shared - copy on write", "[shared]")
+{
+   SECTION("get_mut detaches from other copies")
+   {
+      auto snapshot =
+         make_shared_value<config_snapshot>(config_snapshot{.name = "main", .ports = {}});
+      const auto copy = snapshot;
+
+      snapshot.get_mut().name = "changed";
+
+      CHECK(snapshot->name == "changed");
+      CHECK(copy->name == "main");
+      CHECK(snapshot.use_count() == 1);
+      CHECK(copy.use_count() == 1);
+   }
+   SECTION("get_mut does not copy a unique value")
+   {
+      auto value = make_shared_value<std::string>("unique");
+      const std::string* address = &value.get();
+
+      value.get_mut() += "!";
+
+      CHECK(&value.get() == address);
+      CHECK(value.get() == "unique!");
+   }
+   SECTION("take moves a unique value out")
+   {
+      auto value = make_shared_value<std::vector<int>>(std::vector({1, 2, 3}));
+      const int* data = value->data();
+
+      const std::vector<int> taken = std::move(value).take();
+
+      CHECK(taken.data() == data);
+   }
+   SECTION("take copies a value still referenced elsewhere")
+   {
+      auto value = make_shared_value<std::vector<int>>(std::vector({1, 2, 3}));
+      const auto copy = value;
+
+      const std::vector<int> taken = std::move(value).take();
+
+      CHECK(taken.data() != copy->data());
+      CHECK(taken == *copy);
+      CHECK(copy.use_count() == 1);
+   }
+}
+
+TEST_CASE("shared - shared_maybe", "[shared]")
+{
+   static_assert(std::is_same_v<shared_maybe<std::string>::value_type, std::string>);
+
+   shared_maybe<std::string, local_refcount> name = some(std::string("name"));
+   const shared_maybe<std::string, local_refcount> copy = name;
+
+   SECTION("an empty shared value is none")
+   {
+      shared_maybe<std::string> empty = none;
+
+      CHECK(empty.is_none());
+      CHECK(empty == none);
+      CHECK(empty.use_count() == 0);
+
+      empty.emplace(3, 'a');
+
+      REQUIRE(empty.is_some());
+      CHECK(empty.borrow() == "aaa");
+
+      empty.reset();
+
+      CHECK(empty.is_none());
+   }
+   SECTION("copies share the value")
+   {
+      CHECK(name.use_count() == 2);
+      CHECK(&name.borrow() == &copy.borrow());
+   }
+   SECTION("callables receive the value")
+   {
+      const shared_maybe<std::size_t, local_refcount> size =
+         copy.transform([](const std::string& value) {
+            return value.size();
+         });
+      const maybe<char> first = copy.and_then([](const std::string& value) -> maybe<char> {
+         return some(char(value.front()));
+      });
+
+      CHECK(size.borrow() == 4);
+      CHECK(first.borrow() == 'n');
+      CHECK(copy.match(
+               [](const std::string& value) {
+                  return value.size();
+               },
+               [] {
+                  return std::size_t(0);
+               }) == 4);
+   }
+   SECTION("mutation detaches from other copies")
+   {
+      name.borrow_mut() += "d";
+
+      CHECK(name.borrow() == "named");
+      CHECK(copy.borrow() == "name");
+      CHECK(copy.use_count() == 1);
+   }
+   SECTION("take moves a unique value out")
+   {
+      shared_maybe<std::vector<int>> values = some(std::vector({1, 2, 3}));
+      const int* data = values.borrow().data();
+
+      const std::vector<int> taken = std::move(values).take();
+
+      CHECK(taken.data() == data);
+      CHECK(values.is_none()); // NOLINT
+   }
+   SECTION("take_or")
+   {
+      const shared_maybe<std::string> empty = none;
+
+      CHECK(copy.take_or("other") == "name");
+      CHECK(copy.use_count() == 2);
+      CHECK(empty.take_or("other") == "other");
+      CHECK(std::move(name).take_or("other") == "name");
+   }
+   SECTION("transform_or, transform_or_else and match with a single callable")
+   {
+      const shared_maybe<std::string> empty = none;
+      const auto size = [](const std::string& value) {
+         return value.size();
+      };
+      const auto zero = [] {
+         return std::size_t(0);
+      };
+      const overloaded describe{[](const std::string& value) {
+                                   return value.size();
+                                },
+                                [](none_t) {
+                                   return std::size_t(0);
+                                }};
+
+      CHECK(copy.transform_or(size, std::size_t(0)) == 4);
+      CHECK(empty.transform_or(size, std::size_t(0)) == 0);
+      CHECK(copy.transform_or_else(size, zero) == 4);
+      CHECK(empty.transform_or_else(size, zero) == 0);
+      CHECK(copy.match(describe) == 4);
+      CHECK(empty.match(describe) == 0);
+   }
+   SECTION("comparisons and swap")
+   {
+      shared_maybe<std::string, local_refcount> empty = none;
+      const shared_maybe<std::string, local_refcount> other = some(std::string("other"));
+
+      CHECK(name == copy);
+      CHECK(name == std::string("name"));
+      CHECK(name != other);
+      CHECK(name < other);
+      CHECK(empty < name);
+      CHECK(name > none);
+
+      std::swap(name, empty);
+
+      CHECK(name.is_none());
+      CHECK(empty.borrow() == "name");
+   }
+}
+
+TEST_CASE("shared - shared_result", "[shared]")
+{
+   static_assert(std::is_same_v<shared_result<std::string, int>::value_type, std::string>);
+
+   const shared_result<config_snapshot, std::string> res(
+      in_place_ok, config_snapshot{.name = "fanned out", .ports = {}});
+
+   SECTION("copies share the value")
+   {
+      std::vector<shared_result<config_snapshot, std::string>> workers(8, res);
+
+      CHECK(res.use_count() == 9);
+      CHECK(workers.back().borrow().name == "fanned out");
+      CHECK(&workers.back().borrow() == &res.borrow());
+   }
+   SECTION("callables receive the value")
+   {
+      const shared_result<std::string, std::string> name =
+         res.transform([](const config_snapshot& c) {
+            return c.name;
+         });
+      const result<std::size_t, std::string> count =
+         res.and_then([](const config_snapshot& c) -> result<std::size_t, std::string> {
+            return ok(c.ports.size());
+         });
+
+      CHECK(name.borrow() == "fanned out");
+      CHECK(count.borrow() == 0);
+   }
+   SECTION("mutation detaches from other copies")
+   {
+      shared_result<config_snapshot, std::string> copy = res;
+
+      copy.borrow_mut().ports.push_back(80);
+
+      CHECK(copy.borrow().ports.size() == 1);
+      CHECK(res.borrow().ports.empty());
+      CHECK(res.use_count() == 1);
+   }
+   SECTION("errors")
+   {
+      shared_result<config_snapshot, int> failed = err(2);
+
+      CHECK(failed.borrow_err() == 2);
+      CHECK(failed.use_count() == 0);
+
+      const shared_result<config_snapshot, long> mapped =
+         std::move(failed).transform_err([](int code) -> long {
+            return code * 2;
+         });
+
+      CHECK(mapped.borrow_err() == 4);
+      CHECK(mapped.match(
+               [](const config_snapshot&) {
+                  return 0L;
+               },
+               [](long code) {
+                  return code;
+               }) == 4);
+   }
+   SECTION("or_else keeps sharing the value")
+   {
+      shared_result<config_snapshot, std::string> copy = res;
+
+      const shared_result<config_snapshot, int> recovered =
+         std::move(copy).or_else([](std::string&&) -> shared_result<config_snapshot, int> {
+            return err(0);
+         });
+
+      CHECK(&recovered.borrow() == &res.borrow());
+   }
+   SECTION("a moved from shared_result checks its empty shared value")
+   {
+      shared_result<config_snapshot, std::string> copy = res;
+      const shared_result<config_snapshot, std::string> moved = std::move(copy);
+
+      CHECK(copy.is_ok()); // NOLINT
+#if defined(__cpp_exceptions)
+      CHECK_THROWS_AS(copy.borrow(), invalid_access_exception);
+      CHECK_THROWS_AS(copy.borrow_mut(), invalid_access_exception);
+      CHECK_THROWS_AS(std::move(copy).take(), invalid_access_exception);
+#endif // defined(__cpp_exceptions)
+      CHECK(moved.borrow().name == "fanned out");
+   }
+   SECTION("lvalues keep sharing the value")
+   {
+      const shared_result<config_snapshot, int> failed = err(2);
+      const auto twice = [](int code) -> long {
+         return code * 2;
+      };
+      const auto recover = [](const std::string&) -> shared_result<config_snapshot, std::string> {
+         return err(std::string("unreachable"));
+      };
+
+      const shared_result<config_snapshot, long> mapped = failed.transform_err(twice);
+      const shared_result<config_snapshot, std::string> kept = res.or_else(recover);
+      const shared_result<config_snapshot, std::size_t> still_shared =
+         res.transform_err([](const std::string& message) {
+            return message.size();
+         });
+
+      CHECK(mapped.borrow_err() == 4);
+      CHECK(failed.borrow_err() == 2);
+      CHECK(&kept.borrow() == &res.borrow());
+      CHECK(&still_shared.borrow() == &res.borrow());
+      CHECK(res.use_count() == 3);
+   }
+   SECTION("and_then widens the error")
+   {
+      const auto check = [](const config_snapshot& c) -> result<std::size_t, int> {
+         if (c.ports.empty())
+         {
+            return err(0);
+         }
+
+         return ok(c.ports.size());
+      };
+
+      const result<std::size_t, error_union<std::string, int>> checked = res.and_then(check);
+
+      CHECK(checked.borrow_err().holds<int>());
+   }
+   SECTION("take_or, take_err_or, join and match with a single callable")
+   {
+      const shared_result<config_snapshot, std::string> failed = err(std::string("failed"));
+      const auto name = [](const config_snapshot& c) {
+         return c.name;
+      };
+      const auto error = [](const std::string& message) {
+         return message;
+      };
+      const overloaded describe{[](const config_snapshot& c) {
+                                   return c.name;
+                                },
+                                [](const std::string& message) {
+                                   return message;
+                                }};
+
+      CHECK(res.take_or(config_snapshot{.name = "other"}).name == "fanned out");
+      CHECK(failed.take_or(config_snapshot{.name = "other"}).name == "other");
+      CHECK(res.take_err_or("none") == "none");
+      CHECK(failed.take_err_or("none") == "failed");
+      CHECK(res.join(name, error) == "fanned out");
+      CHECK(failed.join(name, error) == "failed");
+      CHECK(res.match(describe) == "fanned out");
+      CHECK(failed.match(describe) == "failed");
+
+      shared_result<std::string, std::string> same = ok(std::string("value"));
+
+      CHECK(std::move(same).join() == "value");
+   }
+   SECTION("comparisons and swap")
+   {
+      shared_result<std::string, int> name = ok(std::string("name"));
+      shared_result<std::string, int> error = err(3);
+
+      CHECK(name == ok(std::string("name")));
+      CHECK(error == err(3));
+      CHECK(name != error);
+
+      std::swap(name, error);
+
+      CHECK(name.borrow_err() == 3);
+      CHECK(error.borrow() == "name");
+   }
+}
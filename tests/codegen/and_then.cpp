@@ -0,0 +1,84 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+using namespace reglisse;
+
+namespace
+{
+   constexpr auto parse(int value) -> result<int, int>
+   {
+      if (value < 0)
+      {
+         return err(int(value));
+      }
+
+      return ok(value * 2);
+   }
+   constexpr auto validate(int value) -> result<int, int>
+   {
+      if (value > 1000)
+      {
+         return err(1);
+      }
+
+      return ok(value + 1);
+   }
+
+   constexpr auto lookup(int value) -> maybe<int>
+   {
+      if (value % 4 != 0)
+      {
+         return none;
+      }
+
+      return some(value / 4);
+   }
+} // namespace
+
+extern "C" auto monad_result_and_then(int value) -> int
+{
+   return parse(value).and_then(validate).and_then(validate).take_or(-1);
+}
+
+extern "C" auto manual_result_and_then(int value) -> int
+{
+   if (value < 0)
+   {
+      return -1;
+   }
+
+   const int parsed = value * 2;
+   if (parsed > 1000)
+   {
+      return -1;
+   }
+
+   const int validated = parsed + 1;
+   if (validated > 1000)
+   {
+      return -1;
+   }
+
+   return validated + 1;
+}
+
+extern "C" auto monad_maybe_and_then(int value) -> int
+{
+   return lookup(value).and_then(lookup).take_or(-1);
+}
+
+extern "C" auto manual_maybe_and_then(int value) -> int
+{
+   if (value % 4 != 0)
+   {
+      return -1;
+   }
+
+   const int first = value / 4;
+   if (first % 4 != 0)
+   {
+      return -1;
+   }
+
+   return first / 4;
+}
@@ -0,0 +1,60 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <exception>
+#include <optional>
+
+using namespace reglisse;
+
+namespace
+{
+   struct tagged_result
+   {
+      bool is_ok;
+      union
+      {
+         int value;
+         long error;
+      };
+   };
+} // namespace
+
+extern "C" auto monad_maybe_borrow(const maybe<int>* value) -> int
+{
+   return value->borrow() + 1;
+}
+
+extern "C" auto manual_maybe_borrow(const std::optional<int>* value) -> int
+{
+   return **value + 1;
+}
+
+extern "C" auto monad_maybe_borrow_checked(const maybe<int, terminate_check>* value) -> int
+{
+   return value->borrow() + 1;
+}
+
+extern "C" auto manual_maybe_borrow_checked(const std::optional<int>* value) -> int
+{
+   if (not value->has_value()) [[unlikely]]
+   {
+      std::terminate();
+   }
+
+   return **value + 1;
+}
+
+extern "C" auto monad_result_borrow_err(const result<int, long, terminate_check>* value) -> long
+{
+   return value->borrow_err() + 1;
+}
+
+extern "C" auto manual_result_borrow_err(const tagged_result* value) -> long
+{
+   if (value->is_ok) [[unlikely]]
+   {
+      std::terminate();
+   }
+
+   return value->error + 1; // NOLINT
+}
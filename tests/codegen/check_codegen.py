@@ -0,0 +1,115 @@
+"""
+Compile a codegen snippet to assembly and compare every `monad_<name>` function with its
+`manual_<name>` counterpart, written with plain `if`s.
+
+A monadic function fails the check when it has more branches, calls or stack accesses than the
+manual one, or more instructions than the manual one plus a small allowance for register
+allocation noise.
+
+Usage: check_codegen.py <compiler> <snippet.cpp> [compiler flags...]
+"""
+
+import re
+import subprocess
+import sys
+
+# Exit code reported to ctest as a skipped test.
+SKIP = 77
+
+# Extra instructions tolerated before a monadic function is reported.
+INSTRUCTION_ALLOWANCE = 2
+
+LABEL = re.compile(r'^([A-Za-z_][\w.]*):')
+BRANCH = re.compile(r'^j(?!mp\b)\w+\s')
+CALL = re.compile(r'^call\w*\s|^jmp\s+\*?[A-Za-z_]')
+STACK = re.compile(r'%[re]?sp\b|%[re]?bp\b|^push|^pop')
+
+
+def compile_to_assembly(compiler, source, flags):
+    command = [compiler, '-std=c++20', '-O2', '-DNDEBUG', '-S', '-o', '-',
+               '-fno-asynchronous-unwind-tables', *flags, source]
+    return subprocess.run(command, check=True, capture_output=True, text=True).stdout
+
+
+def split_functions(assembly):
+    """
+    Map every function to its instructions. Cold parts split by the compiler, such as
+    `name.cold`, are counted with the function they were split from.
+    """
+    functions = {}
+    current = None
+
+    for line in assembly.splitlines():
+        label = LABEL.match(line)
+        if label:
+            name = label.group(1)
+            if not name.startswith('.'):
+                current = functions.setdefault(name.split('.')[0], [])
+            continue
+
+        instruction = line.strip()
+        if current is None or not instruction or instruction.startswith(('.', '#', '/')):
+            continue
+
+        current.append(instruction)
+
+    return functions
+
+
+def measure(instructions):
+    return {
+        'instructions': len(instructions),
+        'branches': sum(1 for i in instructions if BRANCH.match(i)),
+        'calls': sum(1 for i in instructions if CALL.match(i)),
+        'stack': sum(1 for i in instructions if STACK.search(i)),
+    }
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        return 2
+
+    compiler, source, flags = sys.argv[1], sys.argv[2], sys.argv[3:]
+
+    target = subprocess.run([compiler, '-dumpmachine'], check=True, capture_output=True,
+                            text=True).stdout
+    if not target.startswith('x86_64'):
+        print(f'skipped: the checks only read x86-64 assembly, not {target.strip()}')
+        return SKIP
+
+    functions = split_functions(compile_to_assembly(compiler, source, flags))
+
+    pairs = sorted(name[len('monad_'):] for name in functions if name.startswith('monad_'))
+    if not pairs:
+        print(f'error: no monad_ function in {source}')
+        return 1
+
+    failed = False
+    for name in pairs:
+        if f'manual_{name}' not in functions:
+            print(f'error: monad_{name} has no manual_{name} counterpart')
+            failed = True
+            continue
+
+        monad = measure(functions[f'monad_{name}'])
+        manual = measure(functions[f'manual_{name}'])
+
+        regressions = [key for key in ('branches', 'calls', 'stack') if monad[key] > manual[key]]
+        if monad['instructions'] > manual['instructions'] + INSTRUCTION_ALLOWANCE:
+            regressions.append('instructions')
+
+        status = 'FAIL' if regressions else 'ok'
+        print(f'{status:4} {name}: ' +
+              ', '.join(f'{key} {monad[key]}/{manual[key]}' for key in monad))
+
+        if regressions:
+            failed = True
+            print('     monadic:\n        ' + '\n        '.join(functions[f'monad_{name}']))
+            print('     manual:\n        ' + '\n        '.join(functions[f'manual_{name}']))
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,135 @@
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/overloaded.hpp>
+#include <libreglisse/result.hpp>
+
+#include <optional>
+
+using namespace reglisse;
+
+namespace
+{
+   struct tagged_result
+   {
+      bool is_ok;
+      union
+      {
+         int value;
+         long error;
+      };
+   };
+
+   struct tagged_either
+   {
+      bool is_left;
+      union
+      {
+         int left;
+         float right;
+      };
+   };
+} // namespace
+
+extern "C" auto monad_maybe_match(const maybe<int>* value, int fallback) -> int
+{
+   return value->match(
+      [](int i) {
+         return i * 2;
+      },
+      [&] {
+         return fallback;
+      });
+}
+
+extern "C" auto manual_maybe_match(const std::optional<int>* value, int fallback) -> int
+{
+   if (value->has_value())
+   {
+      return **value * 2;
+   }
+
+   return fallback;
+}
+
+extern "C" auto monad_maybe_match_overloaded(const maybe<int>* value, int fallback) -> int
+{
+   return value->match(overloaded{[](int i) {
+                                     return i * 2;
+                                  },
+                                  [&](none_t) {
+                                     return fallback;
+                                  }});
+}
+
+extern "C" auto manual_maybe_match_overloaded(const std::optional<int>* value, int fallback)
+   -> int
+{
+   if (value->has_value())
+   {
+      return **value * 2;
+   }
+
+   return fallback;
+}
+
+extern "C" auto monad_result_match(const result<int, long>* value) -> long
+{
+   return value->match(
+      [](int i) {
+         return static_cast<long>(i) + 1;
+      },
+      [](long e) {
+         return -e;
+      });
+}
+
+extern "C" auto manual_result_match(const tagged_result* value) -> long
+{
+   if (value->is_ok)
+   {
+      return static_cast<long>(value->value) + 1; // NOLINT
+   }
+
+   return -value->error; // NOLINT
+}
+
+extern "C" auto monad_result_match_overloaded(const result<int, long>* value) -> long
+{
+   return value->match(overloaded{[](int i) {
+                                     return static_cast<long>(i) + 1;
+                                  },
+                                  [](long e) {
+                                     return -e;
+                                  }});
+}
+
+extern "C" auto manual_result_match_overloaded(const tagged_result* value) -> long
+{
+   if (value->is_ok)
+   {
+      return static_cast<long>(value->value) + 1; // NOLINT
+   }
+
+   return -value->error; // NOLINT
+}
+
+extern "C" auto monad_either_match(const either<int, float>* value) -> int
+{
+   return value->match(
+      [](int i) {
+         return i + 1;
+      },
+      [](float f) {
+         return static_cast<int>(f);
+      });
+}
+
+extern "C" auto manual_either_match(const tagged_either* value) -> int
+{
+   if (value->is_left)
+   {
+      return value->left + 1; // NOLINT
+   }
+
+   return static_cast<int>(value->right); // NOLINT
+}
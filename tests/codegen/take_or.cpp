@@ -0,0 +1,49 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <optional>
+
+using namespace reglisse;
+
+namespace
+{
+   struct tagged_result
+   {
+      bool is_ok;
+      union
+      {
+         int value;
+         long error;
+      };
+   };
+} // namespace
+
+extern "C" auto monad_maybe_take_or(const maybe<int>* value, int fallback) -> int
+{
+   return maybe<int>(*value).take_or(fallback);
+}
+
+extern "C" auto manual_maybe_take_or(const std::optional<int>* value, int fallback) -> int
+{
+   if (value->has_value())
+   {
+      return **value;
+   }
+
+   return fallback;
+}
+
+extern "C" auto monad_result_take_or(const result<int, long>* value, int fallback) -> int
+{
+   return result<int, long>(*value).take_or(fallback);
+}
+
+extern "C" auto manual_result_take_or(const tagged_result* value, int fallback) -> int
+{
+   if (value->is_ok)
+   {
+      return value->value; // NOLINT
+   }
+
+   return fallback;
+}
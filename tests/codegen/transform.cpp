@@ -0,0 +1,54 @@
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+using namespace reglisse;
+
+namespace
+{
+   constexpr auto scale(int value) -> int
+   {
+      return value * 3;
+   }
+   constexpr auto offset(int value) -> long
+   {
+      return static_cast<long>(value) + 7;
+   }
+   constexpr auto halve(long value) -> long
+   {
+      return value >> 1;
+   }
+} // namespace
+
+extern "C" auto monad_maybe_transform(bool is_some, int value) -> long
+{
+   auto input = is_some ? maybe<int>(some(int(value))) : maybe<int>(none);
+
+   return std::move(input).transform(scale).transform(offset).transform(halve).take_or(0L);
+}
+
+extern "C" auto manual_maybe_transform(bool is_some, int value) -> long
+{
+   if (not is_some)
+   {
+      return 0L;
+   }
+
+   return halve(offset(scale(value)));
+}
+
+extern "C" auto monad_result_transform(bool is_ok, int value) -> long
+{
+   auto input = is_ok ? result<int, int>(ok(int(value))) : result<int, int>(err(int(value)));
+
+   return std::move(input).transform(scale).transform(offset).transform(halve).take_or(0L);
+}
+
+extern "C" auto manual_result_transform(bool is_ok, int value) -> long
+{
+   if (not is_ok)
+   {
+      return 0L;
+   }
+
+   return halve(offset(scale(value)));
+}
@@ -0,0 +1,319 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+import reglisse;
+
+using namespace reglisse;
+
+namespace
+{
+   struct probe
+   {
+   };
+
+   struct point
+   {
+      std::int32_t x;
+      std::int32_t y;
+   };
+
+   struct parse_error
+   {
+   };
+
+   struct range_error
+   {
+   };
+
+   auto parse_positive(int value) -> int
+   {
+#if defined(__cpp_exceptions)
+      if (value < 0)
+      {
+         throw std::invalid_argument("negative");
+      }
+#endif // defined(__cpp_exceptions)
+
+      return value;
+   }
+} // namespace
+
+// The traits of the module may be specialized by importers.
+
+template <class Check>
+struct reglisse::expected_outcome<reglisse::maybe<probe, Check>> : reglisse::failure_is_likely
+{
+};
+
+template <>
+struct reglisse::is_trivially_relocatable<point> : std::true_type
+{
+};
+
+TEST_CASE("module - check policies", "[module]")
+{
+   static_assert(check_policy<assert_check>);
+   static_assert(check_policy<no_check>);
+   static_assert(check_policy<terminate_check>);
+   static_assert(check_policy<throw_check>);
+   static_assert(std::same_as<maybe<int>, maybe<int, default_check>>);
+
+   const maybe<int, no_check> unchecked = some(1);
+   const maybe<int, assert_check> asserted = some(2);
+   const maybe<int, terminate_check> terminating = some(3);
+
+   CHECK(unchecked.borrow() + asserted.borrow() + terminating.borrow() == 6);
+
+#if defined(__cpp_exceptions)
+   const maybe<int, throw_check> empty = none;
+
+   CHECK_THROWS_AS(empty.borrow(), invalid_access_exception);
+#endif // defined(__cpp_exceptions)
+}
+
+TEST_CASE("module - likelihood", "[module]")
+{
+   static_assert(expected_outcome_v<maybe<probe>> == outcome_likelihood::failure_likely);
+   static_assert(expected_outcome_v<maybe<int>> == outcome_likelihood::unknown);
+   static_assert(std::derived_from<expected_outcome<maybe<int>>,
+                                   outcome_constant<outcome_likelihood::unknown>>);
+   static_assert(success_is_likely::value == outcome_likelihood::success_likely);
+
+   CHECK(maybe<probe>(none).is_none());
+}
+
+TEST_CASE("module - relocate", "[module]")
+{
+   static_assert(is_trivially_relocatable<point>::value);
+   static_assert(is_trivially_relocatable_v<maybe<std::unique_ptr<int>>>);
+
+   std::allocator<point> alloc;
+
+   point* source = alloc.allocate(2);
+   point* dest = alloc.allocate(2);
+
+   std::construct_at(source, point{1, 2});
+   std::construct_at(source + 1, point{3, 4});
+
+   CHECK(relocate(source, source + 2, dest) == dest + 2);
+   CHECK(dest[1].y == 4);
+
+   std::destroy_n(dest, 2);
+   alloc.deallocate(source, 2);
+   alloc.deallocate(dest, 2);
+}
+
+TEST_CASE("module - maybe", "[module]")
+{
+   auto value = maybe<int>(some(3));
+   const none_t nothing = none;
+
+   CHECK(value == 3);
+   CHECK(value != nothing);
+   CHECK((value <=> maybe<int>(some(4))) == std::strong_ordering::less);
+   CHECK(std::move(value).transform([](int v) { return v * 2; }).take_or(0) == 6);
+   CHECK(make_maybe<std::string>("text").borrow() == "text");
+}
+
+TEST_CASE("module - result", "[module]")
+{
+   const auto value = result<int, std::string>(ok(3));
+   const auto error = result<int, std::string>(err(std::string("error")));
+
+   static_assert(std::same_as<decltype(in_place_ok), const in_place_ok_t>);
+   static_assert(std::same_as<decltype(in_place_err), const in_place_err_t>);
+
+   CHECK(value == ok(3));
+   CHECK(error == err(std::string("error")));
+   CHECK(result<int, std::string>(in_place_ok, 1) == make_ok<int, std::string>(1));
+   CHECK(result<int, std::string>(in_place_err, "e") == make_err<int, std::string>("e"));
+   CHECK(result<int, std::string>(value).and_then([](int v) -> result<int, std::string> {
+      return ok(v + 1);
+   }) == ok(4));
+}
+
+TEST_CASE("module - error_union", "[module]")
+{
+   const auto parse = [](int v) -> result<int, parse_error> {
+      return ok(int(v));
+   };
+   const auto check = [](int v) -> result<int, range_error> {
+      if (v > 10)
+      {
+         return err(range_error{});
+      }
+
+      return ok(int(v));
+   };
+
+   const result<int, error_union<parse_error, range_error>> checked = parse(20).and_then(check);
+
+   REQUIRE(checked.is_err());
+   CHECK(checked.borrow_err().holds<range_error>());
+}
+
+TEST_CASE("module - either", "[module]")
+{
+   auto value = either<int, std::string>(left(3));
+
+   static_assert(std::same_as<decltype(in_place_left), const in_place_left_t>);
+   static_assert(std::same_as<decltype(in_place_right), const in_place_right_t>);
+
+   CHECK(value == left(3));
+   CHECK(either<int, std::string>(in_place_right, "r") == right(std::string("r")));
+   CHECK(make_left<int, std::string>(1) == either<int, std::string>(in_place_left, 1));
+   CHECK(make_right<int, std::string>("r").borrow_right() == "r");
+   CHECK(std::move(value).transform_left([](int v) { return std::to_string(v); }).join() ==
+         "3");
+}
+
+TEST_CASE("module - match and overloaded", "[module]")
+{
+   const result<int, std::string> value = ok(2);
+
+   CHECK(match(value, overloaded{[](int v) { return v; },
+                                 [](const std::string& e) { return int(e.size()); }}) == 2);
+}
+
+TEST_CASE("module - zip and lift", "[module]")
+{
+   const maybe<std::tuple<int, std::string>> zipped =
+      zip(maybe<int>(some(1)), maybe<std::string>(some(std::string("a"))));
+   const result<int, int> lifted = lift(std::plus<>(), result<int, int>(ok(1)),
+                                        result<int, int>(ok(2)));
+
+   CHECK(std::get<1>(zipped.borrow()) == "a");
+   CHECK(lifted.borrow() == 3);
+}
+
+TEST_CASE("module - try_wrap", "[module]")
+{
+   CHECK(try_wrap<std::invalid_argument>(parse_positive, 3) == ok(3));
+}
+
+TEST_CASE("module - ref", "[module]")
+{
+   int target = 1;
+   const mut_ref<int> reference = target;
+   const const_ref<int> view = target;
+   const ref<int> plain = target;
+
+   reference.get() = 2;
+
+   CHECK(view.get() == 2);
+   CHECK(plain.get() == 2);
+}
+
+TEST_CASE("module - one_of", "[module]")
+{
+   const alternative<1, std::string> second = at<1>(std::string("one"));
+   const one_of<int, std::string> value = at<1>(std::string("one"));
+
+   CHECK(value.is<1>());
+   CHECK(value == one_of<int, std::string>(at<1>(std::string("one"))));
+   CHECK(std::move(second).value() == "one");
+}
+
+TEST_CASE("module - boxed and shared", "[module]")
+{
+   const boxed<std::string> box = make_boxed<std::string>("boxed");
+   const boxed<std::string> allocated =
+      allocate_boxed<std::string>(std::allocator<std::string>(), "allocated");
+   const maybe_box<std::string> maybe_boxed = some(std::string("maybe"));
+   const result_box<std::string, int> result_boxed = err(1);
+
+   CHECK(*box == "boxed");
+   CHECK(*allocated == "allocated");
+   CHECK(maybe_boxed.borrow() == "maybe");
+   CHECK(result_boxed.borrow_err() == 1);
+
+   const shared<std::string> atomic = make_shared_value<std::string>("atomic");
+   const shared<std::string, local_refcount> local =
+      make_shared_value<std::string, local_refcount>("local");
+   const shared_maybe<std::string, atomic_refcount> shared_value =
+      some(shared<std::string>(atomic));
+   const shared_result<std::string, int> shared_error = err(2);
+
+   CHECK(*local == "local");
+   CHECK(shared_value.use_count() == 2);
+   CHECK(shared_error.borrow_err() == 2);
+}
+
+TEST_CASE("module - maybe_tuple", "[module]")
+{
+   maybe_tuple<int, std::string> fields;
+
+   fields.emplace<1>("field");
+
+   const maybe_field<std::string, std::uint8_t> name = fields.get<1>();
+
+   CHECK(fields.get<0>().is_none());
+   CHECK(name.borrow() == "field");
+}
+
+TEST_CASE("module - nan_boxed", "[module]")
+{
+   const nan_boxed_either<double, std::int32_t> value = right(std::int32_t(7));
+   const nan_boxed_result<double, std::int32_t> error = err(std::int32_t(8));
+
+   CHECK(value.take_right() == 7);
+   CHECK(error.take_err() == 8);
+}
+
+TEST_CASE("module - any_maybe and any_result", "[module]")
+{
+   any_maybe value = maybe<std::string>(some(std::string("any")));
+   any_result error = result<int, std::string>(err(std::string("failed")));
+
+   CHECK(value.type() == typeid(std::string));
+   CHECK(std::move(value).to_maybe<std::string>().borrow() == "any");
+   CHECK(std::move(error).to_result<int, std::string>().borrow_err() == "failed");
+}
+
+TEST_CASE("module - optional_view", "[module]")
+{
+   std::optional<int> target = 1;
+   const optional_view view = target;
+
+   view.emplace(2);
+
+   CHECK(*target == 2);
+}
+
+TEST_CASE("module - c_abi", "[module]")
+{
+   static_assert(c_layout_of<reglisse_maybe_i32, maybe<std::int32_t>>);
+   static_assert(std::same_as<c_abi_type<maybe<std::int64_t>>::type, reglisse_maybe_i64>);
+   static_assert(std::same_as<c_abi_type_t<maybe<std::uint32_t>>, reglisse_maybe_u32>);
+   static_assert(std::same_as<c_abi_type_t<maybe<std::uint64_t>>, reglisse_maybe_u64>);
+   static_assert(std::same_as<c_abi_type_t<maybe<double>>, reglisse_maybe_f64>);
+   static_assert(std::same_as<c_abi_type_t<maybe<void*>>, reglisse_maybe_ptr>);
+   static_assert(std::same_as<c_abi_type_t<result<std::int32_t, std::int32_t>>,
+                              reglisse_result_i32_i32>);
+   static_assert(std::same_as<c_abi_type_t<result<std::int64_t, std::int32_t>>,
+                              reglisse_result_i64_i32>);
+   static_assert(std::same_as<c_abi_type_t<result<std::uint64_t, std::int32_t>>,
+                              reglisse_result_u64_i32>);
+   static_assert(std::same_as<c_abi_type_t<result<double, std::int32_t>>,
+                              reglisse_result_f64_i32>);
+   static_assert(std::same_as<c_abi_type_t<result<void*, std::int32_t>>,
+                              reglisse_result_ptr_i32>);
+
+   const reglisse_result_i64_i32 raw = to_c(result<std::int64_t, std::int32_t>(ok(4L)));
+
+   CHECK(raw.is_ok);
+   CHECK(from_c<result<std::int64_t, std::int32_t>>(raw).borrow() == 4);
+}